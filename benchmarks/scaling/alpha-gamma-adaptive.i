@@ -0,0 +1,183 @@
+# Scaling benchmark: alpha-gamma viscoplasticity with hardening under confined compression and
+# adaptive refinement where plasticity localizes
+# Initial mesh of n x n x n elements, 3 * (n + 1)^3 DOFs, refined up to two levels
+# Usage: lemur-opt -i alpha-gamma.i n=<size> steps=<number of time steps>
+
+n = 16
+steps = 5
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = ${n}
+  ny = ${n}
+  nz = ${n}
+  xmin = 0
+  xmax = 1
+  ymin = 0
+  ymax = 1
+  zmin = 0
+  zmax = 1
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./mech_x]
+    type = LMStressDivergence
+    variable = disp_x
+    component = 0
+  [../]
+  [./mech_y]
+    type = LMStressDivergence
+    variable = disp_y
+    component = 1
+  [../]
+  [./mech_z]
+    type = LMStressDivergence
+    variable = disp_z
+    component = 2
+  [../]
+[]
+
+[BCs]
+  [./no_ux]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0.0
+    preset = true
+  [../]
+  [./ux_right]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = '-1.0e-3*t'
+  [../]
+  [./no_uy]
+    type = DirichletBC
+    variable = disp_y
+    boundary = top
+    value = 0.0
+    preset = true
+  [../]
+  [./uy_bottom]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = bottom
+    function = '-1.0e-3*t'
+  [../]
+  [./no_uz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'front back'
+    value = 0.0
+    preset = true
+  [../]
+[]
+
+[Materials]
+  [./elastic_mat]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 1.0e+10
+    shear_modulus = 1.0e+10
+    initial_stress = '-1.0e+7 -1.0e+7 -1.0e+7'
+    viscoplastic_model = 'plastic'
+  [../]
+  [./plastic]
+    type = LMAlphaGammaYield
+    friction_angle = 30.0
+    critical_pressure = 1.0e+8
+    plastic_viscosity = 1.0e+7
+    critical_pressure_hardening = 10.0
+  [../]
+[]
+
+[Postprocessors]
+  [./ndofs]
+    type = NumDOFs
+  [../]
+  [./nl_its_step]
+    type = NumNonlinearIterations
+    outputs = none
+  [../]
+  [./lin_its_step]
+    type = NumLinearIterations
+    outputs = none
+  [../]
+  [./nl_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nl_its_step
+  [../]
+  [./lin_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = lin_its_step
+  [../]
+  [./memory]
+    type = MemoryUsage
+    value_type = total
+    report_peak_value = true
+  [../]
+  [./wall_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  [../]
+[]
+
+[Adaptivity]
+  marker = localization
+  max_h_level = 2
+  [./Indicators]
+    [./plastic_strain]
+      type = LMInelasticIndicator
+      quantity = plastic_strain_increment
+    [../]
+    [./yield_proximity]
+      type = LMInelasticIndicator
+      quantity = yield_function
+      yield_tolerance = 1.0e+6
+    [../]
+  [../]
+  [./Markers]
+    [./localization]
+      type = LMLocalizationMarker
+      indicators = 'plastic_strain yield_proximity'
+      refine = '1.0e-6 1.0e+3'
+      coarsen = '1.0e-8 1.0e-3'
+    [../]
+  [../]
+[]
+
+[Preconditioning]
+  [./precond]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew'
+    petsc_options_iname = '-ksp_type -pc_type -snes_atol -snes_rtol -snes_max_it -ksp_max_it -pc_hypre_type'
+    petsc_options_value = 'gmres hypre 1E-15 1E-10 20 100 boomeramg'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  automatic_scaling = true
+  start_time = 0.0
+  num_steps = ${steps}
+  dt = 1.0
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  perf_graph = true
+  csv = true
+[]
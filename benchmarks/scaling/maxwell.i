@@ -0,0 +1,154 @@
+# Scaling benchmark: Maxwell viscoelasticity (from test/tests/viscoelastic/maxwell.i)
+# Mesh of n x n x n elements, 3 * (n + 1)^3 DOFs (n = 15: ~1.2e+4 DOFs, n = 150: ~1.0e+7 DOFs)
+# Usage: lemur-opt -i maxwell.i n=<size> steps=<number of time steps>
+
+n = 16
+steps = 5
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = ${n}
+  ny = ${n}
+  nz = ${n}
+  xmin = 0
+  xmax = 1
+  ymin = 0
+  ymax = 1
+  zmin = 0
+  zmax = 1
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./mech_x]
+    type = LMStressDivergence
+    variable = disp_x
+    component = 0
+  [../]
+  [./mech_y]
+    type = LMStressDivergence
+    variable = disp_y
+    component = 1
+  [../]
+  [./mech_z]
+    type = LMStressDivergence
+    variable = disp_z
+    component = 2
+  [../]
+[]
+
+[BCs]
+  [./no_ux]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0.0
+    preset = true
+  [../]
+  [./ux_right]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = '-1.0e-14*t'
+  [../]
+  [./no_uy]
+    type = DirichletBC
+    variable = disp_y
+    boundary = top
+    value = 0.0
+    preset = true
+  [../]
+  [./uy_bottom]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = bottom
+    function = '-1.0e-14*t'
+  [../]
+  [./no_uz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'front back'
+    value = 0.0
+    preset = true
+  [../]
+[]
+
+[Materials]
+  [./elastic_mat]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 1.0e+10
+    shear_modulus = 1.0e+10
+    viscoelastic_model = 'maxwell'
+  [../]
+  [./maxwell]
+    type = LMMaxwell
+    viscosity = 1.0e+22
+  [../]
+[]
+
+[Postprocessors]
+  [./ndofs]
+    type = NumDOFs
+  [../]
+  [./nl_its_step]
+    type = NumNonlinearIterations
+    outputs = none
+  [../]
+  [./lin_its_step]
+    type = NumLinearIterations
+    outputs = none
+  [../]
+  [./nl_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nl_its_step
+  [../]
+  [./lin_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = lin_its_step
+  [../]
+  [./memory]
+    type = MemoryUsage
+    value_type = total
+    report_peak_value = true
+  [../]
+  [./wall_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  [../]
+[]
+
+[Preconditioning]
+  [./precond]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew'
+    petsc_options_iname = '-ksp_type -pc_type -snes_atol -snes_rtol -snes_max_it -ksp_max_it -pc_hypre_type'
+    petsc_options_value = 'gmres hypre 1E-15 1E-10 20 100 boomeramg'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  automatic_scaling = true
+  start_time = 0.0
+  num_steps = ${steps}
+  dt = 3.1536e+11
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  perf_graph = true
+  csv = true
+[]
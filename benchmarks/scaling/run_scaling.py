@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+# Strong/weak scaling benchmarks of LEMUR
+#
+# Runs the benchmark inputs of this directory for a range of problem sizes, MPI ranks and threads
+# and collects the wall time, nonlinear/linear iteration counts and memory in a table (CSV and
+# JSON).
+#
+# Examples:
+#   ./run_scaling.py --mode strong --dofs 1e6 --ranks 1 2 4 8 16
+#   ./run_scaling.py --mode weak --dofs 1e5 --ranks 1 8 64 --cases maxwell terzaghi
+#   ./run_scaling.py --dofs 1e4 1e5 1e6 1e7 --ranks 4 --threads 1 2 4
+
+import argparse, csv, json, os, subprocess, sys, time
+
+BENCHMARK_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.abspath(os.path.join(BENCHMARK_DIR, '..', '..'))
+
+# Number of DOFs as a function of the mesh size n for each benchmark
+CASES = {
+  'maxwell': lambda n: 3 * (n + 1)**3,
+  'non-linear-visco': lambda n: 3 * (n + 1)**3,
+  'alpha-gamma': lambda n: 3 * (n + 1)**3,
+  'alpha-gamma-adaptive': lambda n: 3 * (n + 1)**3,
+  'terzaghi': lambda n: 4 * (n + 1)**2 * (10 * n + 1),
+  'terzaghi-fixed-stress': lambda n: 4 * (n + 1)**2 * (10 * n + 1),
+  'wave-explicit': lambda n: 3 * (n + 1)**3,
+}
+
+COLUMNS = ['case', 'mode', 'n', 'ndofs', 'ranks', 'threads', 'steps', 'wall_time', 'solve_time',
+           'nl_its', 'lin_its', 'picard_its', 'memory', 'status']
+
+def meshSize(case, dofs):
+  """Smallest mesh size n with at least the requested number of DOFs"""
+  n = 1
+  while CASES[case](n) < dofs:
+    n += 1
+  return n
+
+def lastRow(filename):
+  """Last row of a MOOSE CSV output as a dict of floats"""
+  with open(filename, 'r') as csvfile:
+    rows = list(csv.DictReader(csvfile))
+  return {key: float(value) for key, value in rows[-1].items()} if rows else {}
+
+def run(args, case, n, ranks, threads):
+  file_base = os.path.join(args.output_dir, '%s_n%d_r%d_t%d' % (case, n, ranks, threads))
+  cmd = [args.executable, '-i', os.path.join(BENCHMARK_DIR, case + '.i'),
+         'n=%d' % n, 'steps=%d' % args.steps, '--n-threads=%d' % threads,
+         'Outputs/file_base=%s' % file_base]
+  if ranks > 1 or args.always_mpiexec:
+    cmd = [args.mpiexec, '-n', str(ranks)] + cmd
+
+  start = time.time()
+  with open(file_base + '.log', 'w') as log:
+    status = subprocess.call(cmd, stdout=log, stderr=subprocess.STDOUT)
+  wall_time = time.time() - start
+
+  row = {'case': case, 'mode': args.mode, 'n': n, 'ranks': ranks, 'threads': threads,
+         'steps': args.steps, 'wall_time': wall_time, 'status': 'ok' if status == 0 else 'failed'}
+  if os.path.exists(file_base + '.csv'):
+    data = lastRow(file_base + '.csv')
+    row['ndofs'] = int(data.get('ndofs', CASES[case](n)))
+    row['solve_time'] = data.get('wall_time')
+    row['nl_its'] = int(data.get('nl_its', 0))
+    row['lin_its'] = int(data.get('lin_its', 0))
+    if 'picard_its' in data:
+      row['picard_its'] = int(data['picard_its'])
+    row['memory'] = data.get('memory')
+  return row
+
+def main():
+  parser = argparse.ArgumentParser(description='Strong/weak scaling benchmarks of LEMUR.')
+  parser.add_argument('--executable', default=os.path.join(ROOT_DIR, 'lemur-' +
+                      os.environ.get('METHOD', 'opt')), help='The LEMUR executable.')
+  parser.add_argument('--mpiexec', default='mpiexec', help='The MPI launcher.')
+  parser.add_argument('--always-mpiexec', action='store_true',
+                      help='Use the MPI launcher for serial runs as well.')
+  parser.add_argument('--cases', nargs='+', default=sorted(CASES.keys()),
+                      choices=sorted(CASES.keys()), help='The benchmarks to run.')
+  parser.add_argument('--mode', choices=['strong', 'weak'], default='strong',
+                      help='Strong scaling (fixed total size) or weak scaling (fixed size per '
+                           'rank).')
+  parser.add_argument('--dofs', nargs='+', type=float, default=[1.0e4],
+                      help='Target numbers of DOFs (total for strong, per rank for weak scaling).')
+  parser.add_argument('--ranks', nargs='+', type=int, default=[1], help='Numbers of MPI ranks.')
+  parser.add_argument('--threads', nargs='+', type=int, default=[1],
+                      help='Numbers of threads per rank.')
+  parser.add_argument('--steps', type=int, default=5, help='Number of time steps per run.')
+  parser.add_argument('--output-dir', default=os.path.join(os.getcwd(), 'scaling_results'),
+                      help='Directory for the outputs of the runs and the result tables.')
+  args = parser.parse_args()
+
+  if not os.path.exists(args.executable):
+    sys.exit('Executable missing: %s' % args.executable)
+  if not os.path.exists(args.output_dir):
+    os.makedirs(args.output_dir)
+
+  rows = []
+  for case in args.cases:
+    for dofs in args.dofs:
+      for ranks in args.ranks:
+        for threads in args.threads:
+          target = dofs * ranks if args.mode == 'weak' else dofs
+          n = meshSize(case, target)
+          row = run(args, case, n, ranks, threads)
+          rows.append(row)
+          print(', '.join('%s=%s' % (key, row.get(key, '')) for key in COLUMNS))
+
+  with open(os.path.join(args.output_dir, 'scaling.csv'), 'w') as csvfile:
+    writer = csv.DictWriter(csvfile, fieldnames=COLUMNS)
+    writer.writeheader()
+    for row in rows:
+      writer.writerow(row)
+  with open(os.path.join(args.output_dir, 'scaling.json'), 'w') as jsonfile:
+    json.dump(rows, jsonfile, indent=2)
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,127 @@
+# Mechanics sub-app of the fixed-stress split of Terzaghi's consolidation
+# (see terzaghi-fixed-stress.i). The fluid pressure is an auxiliary variable set by the parent
+# app before each mechanics solve.
+
+n = 6
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = ${n}
+  ny = ${n}
+  nz = ${fparse 10 * n}
+  xmin = -0.1
+  xmax = 0.1
+  ymin = -0.1
+  ymax = 0.1
+  zmin = 0
+  zmax = 1
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[AuxVariables]
+  [./pf]
+  [../]
+  [./phi]
+    initial_condition = 0.1
+  [../]
+[]
+
+[Kernels]
+  [./grad_stress_x]
+    type = LMStressDivergence
+    variable = disp_x
+    fluid_pressure = pf
+    component = 0
+  [../]
+  [./grad_stress_y]
+    type = LMStressDivergence
+    variable = disp_y
+    fluid_pressure = pf
+    component = 1
+  [../]
+  [./grad_stress_z]
+    type = LMStressDivergence
+    variable = disp_z
+    fluid_pressure = pf
+    component = 2
+  [../]
+[]
+
+[BCs]
+  [./confinex]
+    type = DirichletBC
+    variable = disp_x
+    value = 0
+    boundary = 'left right'
+    preset = true
+  [../]
+  [./confiney]
+    type = DirichletBC
+    variable = disp_y
+    value = 0
+    boundary = 'bottom top'
+    preset = true
+  [../]
+  [./basefixed]
+    type = DirichletBC
+    variable = disp_z
+    value = 0
+    boundary = back
+    preset = true
+  [../]
+  [./topload]
+    type = NeumannBC
+    variable = disp_z
+    value = -1
+    boundary = front
+  [../]
+[]
+
+[Materials]
+  [./mechanical]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 4
+    shear_modulus = 3
+  [../]
+  [./hydraulic]
+    type = LMPoroMaterial
+    porosity = phi
+    permeability = 1.5e-02
+    fluid_viscosity = 1.395348837e-01
+    fluid_modulus = 8
+    solid_modulus = 10
+  [../]
+[]
+
+[Preconditioning]
+  [./hypre]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew'
+    petsc_options_iname = '-pc_type -pc_hypre_type -pc_hypre_boomeramg_strong_threshold
+                           -pc_hypre_boomeramg_nodal_coarsen -pc_hypre_boomeramg_vec_interp_variant
+                           -snes_atol'
+    petsc_options_value = 'hypre boomeramg 0.7 6 3 1.0e-14'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0
+  dt = 0.001
+[]
+
+[Outputs]
+  print_linear_residuals = false
+[]
@@ -0,0 +1,201 @@
+# Scaling benchmark: Terzaghi's consolidation solved with the fixed-stress split
+# Same problem as terzaghi.i, 4 * (n + 1)^2 * (10n + 1) DOFs in total
+# This input solves the fluid flow and runs the mechanics in a sub-app
+# (terzaghi-fixed-stress-mech.i). Both are iterated within each time step until the Picard
+# tolerances are met. The stabilization uses the constrained modulus of the confined problem:
+# K / (K + 4/3 G) = 0.5
+# Usage: lemur-opt -i terzaghi-fixed-stress.i n=<size> steps=<number of time steps>
+
+n = 6
+steps = 5
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = ${n}
+  ny = ${n}
+  nz = ${fparse 10 * n}
+  xmin = -0.1
+  xmax = 0.1
+  ymin = -0.1
+  ymax = 0.1
+  zmin = 0
+  zmax = 1
+[]
+
+[Variables]
+  [./pf]
+  [../]
+[]
+
+[AuxVariables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+  [./pf_iterate]
+  [../]
+  [./phi]
+    initial_condition = 0.1
+  [../]
+[]
+
+[Kernels]
+  [./pf_time_derivative]
+    type = LMFluidFlowTimeDerivative
+    variable = pf
+  [../]
+  [./darcy]
+    type = LMFluidFlowDarcy
+    variable = pf
+  [../]
+  [./fixed_stress]
+    type = LMFixedStressStabilization
+    variable = pf
+    fluid_pressure_iterate = pf_iterate
+    stabilization_factor = 0.5
+  [../]
+[]
+
+[BCs]
+  [./topdrained]
+    type = DirichletBC
+    variable = pf
+    value = 0
+    boundary = front
+  [../]
+[]
+
+[Materials]
+  [./mechanical]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 4
+    shear_modulus = 3
+  [../]
+  [./hydraulic]
+    type = LMPoroMaterial
+    porosity = phi
+    permeability = 1.5e-02
+    fluid_viscosity = 1.395348837e-01
+    fluid_modulus = 8
+    solid_modulus = 10
+  [../]
+[]
+
+[MultiApps]
+  [./mechanics]
+    type = TransientMultiApp
+    app_type = LemurApp
+    input_files = terzaghi-fixed-stress-mech.i
+    cli_args = 'n=${n}'
+    execute_on = timestep_end
+  [../]
+[]
+
+[Transfers]
+  [./pf_to_mechanics]
+    type = MultiAppCopyTransfer
+    direction = to_multiapp
+    multi_app = mechanics
+    source_variable = pf
+    variable = pf
+  [../]
+  [./pf_iterate_from_mechanics]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = pf
+    variable = pf_iterate
+  [../]
+  [./disp_x_from_mechanics]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = disp_x
+    variable = disp_x
+  [../]
+  [./disp_y_from_mechanics]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = disp_y
+    variable = disp_y
+  [../]
+  [./disp_z_from_mechanics]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = disp_z
+    variable = disp_z
+  [../]
+[]
+
+[Postprocessors]
+  # DOFs of the flow app only, the total is given by run_scaling.py
+  [./flow_ndofs]
+    type = NumDOFs
+  [../]
+  [./nl_its_step]
+    type = NumNonlinearIterations
+    outputs = none
+  [../]
+  [./lin_its_step]
+    type = NumLinearIterations
+    outputs = none
+  [../]
+  [./picard_its_step]
+    type = NumPicardIterations
+    outputs = none
+  [../]
+  [./nl_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nl_its_step
+  [../]
+  [./lin_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = lin_its_step
+  [../]
+  [./picard_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = picard_its_step
+  [../]
+  [./memory]
+    type = MemoryUsage
+    value_type = total
+    report_peak_value = true
+  [../]
+  [./wall_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  [../]
+[]
+
+[Preconditioning]
+  [./hypre]
+    type = SMP
+    petsc_options = '-snes_ksp_ew'
+    petsc_options_iname = '-pc_type -pc_hypre_type -pc_hypre_boomeramg_strong_threshold -snes_atol'
+    petsc_options_value = 'hypre boomeramg 0.7 1.0e-14'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0
+  num_steps = ${steps}
+  dt = 0.001
+  picard_max_its = 30
+  picard_rel_tol = 1.0e-08
+  picard_abs_tol = 1.0e-12
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  perf_graph = true
+  csv = true
+[]
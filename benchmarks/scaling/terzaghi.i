@@ -0,0 +1,182 @@
+# Scaling benchmark: Terzaghi's consolidation (from test/tests/poroelastic/terzaghi.i)
+# Column of n x n x 10n elements, 4 * (n + 1)^2 * (10n + 1) DOFs
+# (n = 6: ~1.2e+4 DOFs, n = 63: ~1.0e+7 DOFs)
+# Usage: lemur-opt -i terzaghi.i n=<size> steps=<number of time steps>
+
+n = 6
+steps = 5
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = ${n}
+  ny = ${n}
+  nz = ${fparse 10 * n}
+  xmin = -0.1
+  xmax = 0.1
+  ymin = -0.1
+  ymax = 0.1
+  zmin = 0
+  zmax = 1
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+  [./pf]
+  [../]
+[]
+
+[Kernels]
+  [./grad_stress_x]
+    type = LMStressDivergence
+    variable = disp_x
+    fluid_pressure = pf
+    component = 0
+  [../]
+  [./grad_stress_y]
+    type = LMStressDivergence
+    variable = disp_y
+    fluid_pressure = pf
+    component = 1
+  [../]
+  [./grad_stress_z]
+    type = LMStressDivergence
+    variable = disp_z
+    fluid_pressure = pf
+    component = 2
+  [../]
+  [./pf_time_derivative]
+    type = LMFluidFlowTimeDerivative
+    variable = pf
+  [../]
+  [./darcy]
+    type = LMFluidFlowDarcy
+    variable = pf
+  [../]
+[]
+
+[AuxVariables]
+  [./phi]
+    initial_condition = 0.1
+  [../]
+[]
+
+[BCs]
+  [./confinex]
+    type = DirichletBC
+    variable = disp_x
+    value = 0
+    boundary = 'left right'
+    preset = true
+  [../]
+  [./confiney]
+    type = DirichletBC
+    variable = disp_y
+    value = 0
+    boundary = 'bottom top'
+    preset = true
+  [../]
+  [./basefixed]
+    type = DirichletBC
+    variable = disp_z
+    value = 0
+    boundary = back
+    preset = true
+  [../]
+  [./topdrained]
+    type = DirichletBC
+    variable = pf
+    value = 0
+    boundary = front
+  [../]
+  [./topload]
+    type = NeumannBC
+    variable = disp_z
+    value = -1
+    boundary = front
+  [../]
+[]
+
+[Materials]
+  [./mechanical]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 4
+    shear_modulus = 3
+  [../]
+  [./hydraulic]
+    type = LMPoroMaterial
+    porosity = phi
+    permeability = 1.5e-02
+    fluid_viscosity = 1.395348837e-01
+    fluid_modulus = 8
+    solid_modulus = 10
+  [../]
+[]
+
+[Postprocessors]
+  [./ndofs]
+    type = NumDOFs
+  [../]
+  [./nl_its_step]
+    type = NumNonlinearIterations
+    outputs = none
+  [../]
+  [./lin_its_step]
+    type = NumLinearIterations
+    outputs = none
+  [../]
+  [./nl_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nl_its_step
+  [../]
+  [./lin_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = lin_its_step
+  [../]
+  [./memory]
+    type = MemoryUsage
+    value_type = total
+    report_peak_value = true
+  [../]
+  [./wall_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  [../]
+[]
+
+[Preconditioning]
+  [./hypre]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew'
+    petsc_options_iname = '-pc_type -pc_hypre_type
+                           -pc_hypre_boomeramg_strong_threshold -pc_hypre_boomeramg_agg_nl -pc_hypre_boomeramg_agg_num_paths -pc_hypre_boomeramg_max_levels
+                           -pc_hypre_boomeramg_coarsen_type -pc_hypre_boomeramg_interp_type
+                           -pc_hypre_boomeramg_P_max -pc_hypre_boomeramg_truncfacto -snes_atol'
+    petsc_options_value = 'hypre boomeramg
+                           0.7 4 5 25
+                           HMIS ext+i
+                           2 0.3 1.0e-14'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0
+  num_steps = ${steps}
+  dt = 0.001
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  perf_graph = true
+  csv = true
+[]
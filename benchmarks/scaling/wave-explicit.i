@@ -0,0 +1,127 @@
+# Scaling benchmark: compressional wave in an elastic cube solved with explicit dynamics
+# (central difference with a lumped mass matrix, no global solve)
+# Cube of n x n x n elements, 3 * (n + 1)^3 DOFs
+# (n = 15: ~1.2e+4 DOFs, n = 214: ~1.0e+7 DOFs)
+# The time step is the stable time step of the current moduli.
+# Usage: lemur-opt -i wave-explicit.i n=<size> steps=<number of time steps>
+
+n = 15
+steps = 5
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = ${n}
+  ny = ${n}
+  nz = ${n}
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./inertia_x]
+    type = LMInertialForce
+    variable = disp_x
+    density = 2.7e+03
+  [../]
+  [./inertia_y]
+    type = LMInertialForce
+    variable = disp_y
+    density = 2.7e+03
+  [../]
+  [./inertia_z]
+    type = LMInertialForce
+    variable = disp_z
+    density = 2.7e+03
+  [../]
+  [./grad_stress_x]
+    type = LMStressDivergence
+    variable = disp_x
+    component = 0
+  [../]
+  [./grad_stress_y]
+    type = LMStressDivergence
+    variable = disp_y
+    component = 1
+  [../]
+  [./grad_stress_z]
+    type = LMStressDivergence
+    variable = disp_z
+    component = 2
+  [../]
+[]
+
+[Functions]
+  [./pulse]
+    type = PiecewiseLinear
+    x = '0 1.0e-05 2.0e-05'
+    y = '0 -1.0e+06 0'
+  [../]
+[]
+
+[BCs]
+  [./top_pulse]
+    type = FunctionNeumannBC
+    variable = disp_z
+    function = pulse
+    boundary = front
+  [../]
+[]
+
+[Materials]
+  [./mechanical]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 5.0e+10
+    shear_modulus = 3.0e+10
+    compute_p_wave_modulus = true
+  [../]
+[]
+
+[Postprocessors]
+  [./dt_stable]
+    type = LMStableTimeStep
+    density = 2.7e+03
+    execute_on = 'initial timestep_end'
+  [../]
+  [./ndofs]
+    type = NumDOFs
+  [../]
+  [./memory]
+    type = MemoryUsage
+    value_type = total
+    report_peak_value = true
+  [../]
+  [./wall_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 0
+  num_steps = ${steps}
+  [./TimeIntegrator]
+    type = CentralDifference
+    solve_type = lumped
+  [../]
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt_stable
+    dt = 1.0e-07
+  [../]
+[]
+
+[Outputs]
+  perf_graph = true
+  csv = true
+[]
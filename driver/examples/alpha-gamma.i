@@ -0,0 +1,38 @@
+# Material point for the driver: alpha-gamma viscoplasticity
+# Usage: lemur-driver-opt -i alpha-gamma.i --paths paths.csv --mech-material mech --dt 1.0
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Materials]
+  [./mech]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 1.0e+10
+    shear_modulus = 1.0e+10
+    viscoplastic_model = 'plastic'
+  [../]
+  [./plastic]
+    type = LMAlphaGammaYield
+    friction_angle = 30.0
+    critical_pressure = 1.0e+8
+    critical_pressure_hardening = 10.0
+    plastic_viscosity = 1.0e+7
+    max_substeps = 8
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+[]
@@ -0,0 +1,101 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "FEProblemBase.h"
+#include "LMIsotropicElasticity.h"
+
+class LMMechMaterialBase;
+class LMViscoElasticUpdate;
+class LMViscoPlasticUpdate;
+
+/**
+ * Loading path of a material point. Each of the six tensor components, in the Voigt order of
+ * LMSymmetricTensor (xx, yy, zz, yz, xz, xy), is either strain rate controlled or stress
+ * controlled. All paths start from an isotropic stress
+ * state -confining_pressure * I.
+ */
+struct LMLoadingPath
+{
+  std::string type;
+  Real confining_pressure;
+  Real value;
+  unsigned int num_steps;
+
+  /// Whether each component is stress controlled
+  std::array<bool, 6> stress_controlled;
+  /// Prescribed strain rate (strain controlled) or stress (stress controlled) for each component
+  std::array<Real, 6> target;
+};
+
+/**
+ * Strain and stress history of a path integrated by the driver, the reason of its failure if any
+ * and the number of non-converged local solutions accepted (reported once all threads are done).
+ */
+struct LMPathResult
+{
+  std::vector<Real> time;
+  std::vector<RankTwoTensor> strain;
+  std::vector<RankTwoTensor> stress;
+  std::string failure;
+  unsigned int num_accepted = 0;
+};
+
+/**
+ * Mesh-free driver of the LEMUR rheologies: integrates the material point of a LMMechMaterialBase
+ * material (its elasticity with its viscoelastic and viscoplastic updates) along prescribed strain
+ * or stress paths. Mixed control is solved with a local Newton loop using the AD tangent of the
+ * updates. Paths are distributed over the threads, each thread using its own copy of the
+ * materials. The histories of all paths are written to a single file once all paths are done.
+ * The materials cannot couple any variable, the variables not being evaluated at the material
+ * point.
+ */
+class LMMaterialPointDriver
+{
+public:
+  LMMaterialPointDriver(FEProblemBase & problem,
+                        const std::string & mech_material,
+                        Real dt,
+                        const std::string & output_dir,
+                        bool binary_output);
+
+  /// Reads the loading paths (one per line) from a CSV file
+  static std::vector<LMLoadingPath> readPaths(const std::string & filename);
+
+  /// Integrates all paths
+  void run(const std::vector<LMLoadingPath> & paths);
+
+protected:
+  void runPath(const LMLoadingPath & path, LMPathResult & result, THREAD_ID tid);
+  void update(ADRankTwoTensor & stress,
+              const ADRankTwoTensor & stress_start,
+              const ADLMIsotropicElasticity & Cijkl,
+              ADRankTwoTensor & strain_incr,
+              THREAD_ID tid);
+  void shiftStatefulProperties(THREAD_ID tid);
+  void writeResults(const std::vector<LMPathResult> & results) const;
+
+  FEProblemBase & _problem;
+  const Real _dt;
+  const std::string _output_dir;
+  const bool _binary_output;
+
+  std::vector<LMMechMaterialBase *> _mech;
+  std::vector<LMViscoElasticUpdate *> _ve_model;
+  std::vector<LMViscoPlasticUpdate *> _vp_model;
+
+  // Mixed control Newton loop
+  const Real _tol = 1.0e-10;
+  const unsigned int _max_its = 50;
+};
\ No newline at end of file
@@ -0,0 +1,39 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "Action.h"
+
+class LMPoroMechPreconditionerAction;
+
+template <>
+InputParameters validParams<LMPoroMechPreconditionerAction>();
+
+/**
+ * Sets up a field split preconditioner (displacements / fluid pressure) when LMStressDivergence is
+ * coupled to a fluid pressure and no Preconditioning block is supplied in the input file.
+ */
+class LMPoroMechPreconditionerAction : public Action
+{
+public:
+  LMPoroMechPreconditionerAction(const InputParameters & params);
+
+  virtual void act() override;
+
+protected:
+  void addSplit(const std::string & name,
+                const std::vector<NonlinearVariableName> & vars,
+                const std::string & petsc_options_iname,
+                const std::string & petsc_options_value);
+};
@@ -14,12 +14,14 @@
 #pragma once
 
 #include "AuxKernel.h"
+#include "LMPerfGraph.h"
 
-class LMPorosityAux : public AuxKernel
+class LMPorosityAux : public AuxKernel, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
   LMPorosityAux(const InputParameters & parameters);
+  virtual void compute() override;
 
 protected:
   virtual Real computeValue() override;
@@ -38,4 +40,7 @@ protected:
   const bool _has_vp;
   const ADMaterialProperty<RankTwoTensor> * _plastic_strain_incr;
   const ADMaterialProperty<RankTwoTensor> * _stress;
+
+  // Timed section (see LMPerfGraph.h)
+  const PerfID _compute_timer;
 };
\ No newline at end of file
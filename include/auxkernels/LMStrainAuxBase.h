@@ -14,18 +14,27 @@
 #pragma once
 
 #include "AuxKernel.h"
+#include "LMPerfGraph.h"
 #include "RankTwoTensor.h"
 
-class LMStrainAuxBase : public AuxKernel
+class LMStrainAuxBase : public AuxKernel, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
   LMStrainAuxBase(const InputParameters & parameters);
+  virtual void compute() override;
   static MooseEnum strainType();
+  static std::string strainPropertyName(unsigned int strain_type);
 
 protected:
+  RankTwoTensor strainIncrement() const;
+
   const VariableValue & _u_old;
   MooseEnum _strain_type;
   std::string _strain_name;
   const ADMaterialProperty<RankTwoTensor> * _strain_incr;
+  const MaterialProperty<RankTwoTensor> * _strain_incr_lean;
+
+  // Timed section (see LMPerfGraph.h)
+  const PerfID _compute_timer;
 };
\ No newline at end of file
@@ -14,14 +14,19 @@
 #pragma once
 
 #include "AuxKernel.h"
-#include "RankTwoTensor.h"
+#include "LMPerfGraph.h"
+#include "LMSymmetricTensor.h"
 
-class LMStressAuxBase : public AuxKernel
+class LMStressAuxBase : public AuxKernel, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
   LMStressAuxBase(const InputParameters & parameters);
+  virtual void compute() override;
 
 protected:
-  const ADMaterialProperty<RankTwoTensor> & _stress;
+  const MaterialProperty<LMSymmetricTensor> & _stress;
+
+  // Timed section (see LMPerfGraph.h)
+  const PerfID _compute_timer;
 };
\ No newline at end of file
@@ -0,0 +1,45 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "AuxKernel.h"
+#include "LMPerfGraph.h"
+#include "LMSymmetricTensor.h"
+
+/**
+ * Computes a set of stress and strain components and invariants in a single pass per qp and writes
+ * them to the components of an array variable (one component per requested quantity).
+ */
+class LMTensorOutputAux : public ArrayAuxKernel, public PerfGraphInterface
+{
+public:
+  static InputParameters validParams();
+  LMTensorOutputAux(const InputParameters & parameters);
+  virtual void compute() override;
+  static MultiMooseEnum quantities();
+
+protected:
+  virtual RealEigenVector computeValue() override;
+
+  const ArrayVariableValue & _u_old;
+  std::vector<unsigned int> _quantities;
+  bool _has_stress;
+  bool _has_strain;
+  const MaterialProperty<LMSymmetricTensor> * _stress;
+  const ADMaterialProperty<RankTwoTensor> * _strain_incr;
+  const MaterialProperty<RankTwoTensor> * _strain_incr_lean;
+
+  // Timed section (see LMPerfGraph.h)
+  const PerfID _compute_timer;
+};
@@ -14,15 +14,20 @@
 #pragma once
 
 #include "AuxKernel.h"
+#include "LMPerfGraph.h"
 
-class LMVelocityAux : public AuxKernel
+class LMVelocityAux : public AuxKernel, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
   LMVelocityAux(const InputParameters & parameters);
+  virtual void compute() override;
 
 protected:
   virtual Real computeValue() override;
 
   const VariableValue & _disp_dot;
+
+  // Timed section (see LMPerfGraph.h)
+  const PerfID _compute_timer;
 };
\ No newline at end of file
@@ -0,0 +1,40 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ADIntegratedBC.h"
+
+class Function;
+
+/**
+ * Follower pressure on the reference configuration: the current area normal is obtained from
+ * Nanson's formula n da = J F^-T N dA, so that the AD Jacobian includes the change of the normal
+ * and of the area with the displacements. The pressure function is evaluated at the reference
+ * coordinates.
+ */
+class LMFollowerPressureBC : public ADIntegratedBC
+{
+public:
+  static InputParameters validParams();
+  LMFollowerPressureBC(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  const unsigned int _component;
+  const Real _value;
+  const Function * _function;
+  const unsigned int _ndisp;
+  std::vector<const ADVariableGradient *> _grad_disp;
+};
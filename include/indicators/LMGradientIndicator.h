@@ -0,0 +1,29 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementIndicator.h"
+
+/**
+ * Element indicator of the localization of a field: L2 norm over the element of h * grad(u), to
+ * flag damage fronts and fluid pressure fronts.
+ */
+class LMGradientIndicator : public ElementIndicator
+{
+public:
+  static InputParameters validParams();
+  LMGradientIndicator(const InputParameters & parameters);
+
+  virtual void computeIndicator() override;
+};
@@ -0,0 +1,45 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "Indicator.h"
+#include "RankTwoTensor.h"
+
+/**
+ * Element indicator of the inelastic activity: L2 norm over the element of the plastic strain
+ * increment or of the positive part of the shifted yield function (proximity to yielding).
+ */
+class LMInelasticIndicator : public Indicator
+{
+public:
+  static InputParameters validParams();
+  LMInelasticIndicator(const InputParameters & parameters);
+
+  virtual void computeIndicator() override;
+
+protected:
+  Real computeQpValue(unsigned int qp) const;
+
+  const enum class Quantity { plastic_strain_increment, yield_function } _quantity;
+  const Real _yield_tolerance;
+
+  MooseVariable & _field_var;
+  const QBase * const & _qrule;
+  const MooseArray<Real> & _JxW;
+  const MooseArray<Real> & _coord;
+
+  const ADMaterialProperty<RankTwoTensor> * _plastic_strain_incr;
+  const ADMaterialProperty<Real> * _yield_function;
+  const MaterialProperty<Real> * _yield_function_lean;
+};
@@ -0,0 +1,36 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ADKernel.h"
+
+/**
+ * Stabilization term of the fixed-stress split for the fluid flow equation:
+ * alpha^2 / K * (pf - pf_k) / dt, where pf_k is the fluid pressure of the previous iterate, i.e.
+ * the one used by the last mechanics solve.
+ */
+class LMFixedStressStabilization : public ADKernel
+{
+public:
+  static InputParameters validParams();
+  LMFixedStressStabilization(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  const VariableValue & _pf_iterate;
+  const Real _factor;
+  const ADMaterialProperty<Real> & _biot;
+  const ADMaterialProperty<Real> & _K;
+};
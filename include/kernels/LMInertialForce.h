@@ -0,0 +1,35 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "TimeKernel.h"
+
+/**
+ * Inertia term rho * d2u/dt2 of the momentum balance. Combined with the CentralDifference time
+ * integrator (solve_type = lumped), the mechanics is solved explicitly with a lumped mass matrix.
+ */
+class LMInertialForce : public TimeKernel
+{
+public:
+  static InputParameters validParams();
+  LMInertialForce(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  const Real _rho;
+  const VariableValue & _u_dotdot;
+  const VariableValue & _du_dotdot_du;
+};
@@ -21,6 +21,21 @@ public:
   static InputParameters validParams();
   LMStressDivergence(const InputParameters & parameters);
 
+  /// Qp residual from the row of the stress of the component, shared with the consistent tangent
+  /// mode of the kernel (LMStressDivergenceTangent)
+  template <typename T>
+  static T qpResidual(const TypeVector<T> & stress_row,
+                      const T & biot_pf,
+                      unsigned int component,
+                      const RealVectorValue & body_force,
+                      const RealGradient & grad_test,
+                      Real test)
+  {
+    TypeVector<T> eff_stress_row = stress_row;
+    eff_stress_row(component) -= biot_pf;
+    return eff_stress_row * grad_test - body_force(component) * test;
+  }
+
 protected:
   virtual ADReal computeQpResidual() override;
 
@@ -0,0 +1,43 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "Kernel.h"
+#include "RankFourTensor.h"
+
+/**
+ * Consistent tangent mode of LMStressDivergence: same residual, the Jacobian being assembled from
+ * the algorithmic consistent tangent computed by the mechanical material
+ * (consistent_tangent = true) instead of automatic differentiation. The tangent being restricted
+ * to the purely mechanical small strain problem, the fluid pressure cannot be coupled.
+ */
+class LMStressDivergenceTangent : public Kernel
+{
+public:
+  static InputParameters validParams();
+  LMStressDivergenceTangent(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  const unsigned int _ndisp;
+  std::vector<unsigned int> _disp_var;
+  const unsigned int _component;
+  const Real _rho;
+  const RealVectorValue _gravity;
+  const ADMaterialProperty<RankTwoTensor> & _stress;
+  const MaterialProperty<RankFourTensor> & _tangent;
+};
@@ -0,0 +1,35 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "Marker.h"
+
+/**
+ * Marker combining several indicators (e.g. LMInelasticIndicator and LMGradientIndicator): an
+ * element is refined if any indicator exceeds its refine threshold and coarsened if all
+ * indicators are below their coarsen thresholds.
+ */
+class LMLocalizationMarker : public Marker
+{
+public:
+  static InputParameters validParams();
+  LMLocalizationMarker(const InputParameters & parameters);
+
+protected:
+  virtual MarkerValue computeElementMarker() override;
+
+  const std::vector<Real> _refine;
+  const std::vector<Real> _coarsen;
+  std::vector<ErrorVector *> _error_vectors;
+};
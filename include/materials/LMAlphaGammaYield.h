@@ -44,6 +44,17 @@ protected:
                                 const ADReal & gamma_d,
                                 ADReal & over_v_d,
                                 ADReal & over_d_d) override;
+  virtual void overStressAndDerivs(const ADReal & gamma_v,
+                                   const ADReal & gamma_d,
+                                   ADReal & over_v,
+                                   ADReal & over_d,
+                                   ADReal & over_v_v,
+                                   ADReal & over_d_v,
+                                   ADReal & over_v_d,
+                                   ADReal & over_d_d) override;
+  virtual Real volumetricWeight() const { return 1.0; }
+  virtual Real deviatoricWeight() const { return 1.0; }
+  virtual void initQpUpdate() override;
   virtual void preReturnMap() override;
   virtual void postReturnMap(const ADReal & gamma_v, const ADReal & gamma_d) override;
   virtual ADRankTwoTensor reformPlasticStrainTensor(const ADReal & gamma_v,
@@ -54,19 +65,6 @@ protected:
                                        ADReal & chi_v,
                                        ADReal & chi_d) override;
   virtual void updateYieldParameters(const ADReal & gamma_v);
-  virtual ADReal dyieldFunctiondVol(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal dyieldFunctiondDev(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal d2yieldFunctiondVol2(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal d2yieldFunctiondVolDev(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal d2yieldFunctiondDevVol(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal d2yieldFunctiondDev2(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal dyieldFunctiondA(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal dyieldFunctiondB(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal d2yieldFunctiondVolA(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal d2yieldFunctiondVolB(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal d2yieldFunctiondDevA(const ADReal & chi_v, const ADReal & chi_d);
-  virtual ADReal d2yieldFunctiondDevB(const ADReal & chi_v, const ADReal & chi_d);
-
   const Real _phi;
   const Real _pcr0;
   const Real _alpha;
@@ -81,6 +79,8 @@ protected:
   ADReal _eqv_stress_tr;
 
   ADReal _pcr_tr;
+  // Whether _pcr_tr is up to date with the internal variable (reset at each substep)
+  bool _pcr_tr_valid;
   ADReal _one_on_A;
   ADReal _one_on_B;
 
@@ -20,27 +20,28 @@ class LMDamageAlphaGammaYield : public LMAlphaGammaYield
 public:
   static InputParameters validParams();
   LMDamageAlphaGammaYield(const InputParameters & parameters);
+  virtual bool hasCoupledVariables() override
+  {
+    return LMAlphaGammaYield::hasCoupledVariables() || isCoupled("damage");
+  }
 
 protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void initQpUpdate() override;
+  virtual bool substepUpdate(ADRankTwoTensor & stress,
+                             const ADLMIsotropicElasticity & Cijkl) override;
   virtual void preReturnMap() override;
-  virtual void overStress(const ADReal & gamma_v,
-                          const ADReal & gamma_d,
-                          ADReal & over_v,
-                          ADReal & over_d) override;
-  virtual void overStressDerivV(const ADReal & gamma_v,
-                                const ADReal & gamma_d,
-                                ADReal & over_v_v,
-                                ADReal & over_d_v) override;
-  virtual void overStressDerivD(const ADReal & gamma_v,
-                                const ADReal & gamma_d,
-                                ADReal & over_v_d,
-                                ADReal & over_d_d) override;
+  virtual Real volumetricWeight() const override { return Utility::pow<2>(_rv); }
+  virtual Real deviatoricWeight() const override { return Utility::pow<2>(_rs); }
   virtual void updateYieldParameters(const ADReal & gamma_v) override;
   virtual void updateYieldParametersDerivV(ADReal & dA, ADReal & dB) override;
   virtual void postReturnMap(const ADReal & gamma_v, const ADReal & gamma_d) override;
 
-  // Coupled variables
-  const ADVariableValue & _damage;
+  // Damage variable, or damage integrated locally as a stateful property
+  const bool _local_damage;
+  const ADVariableValue * _damage_var;
+  ADMaterialProperty<Real> * _damage_prop;
+  const MaterialProperty<Real> * _damage_old;
   // // Damage viscosity
   // const Real _eta_a;
   // Dissipation contributions
@@ -49,4 +50,7 @@ protected:
 
   // Properties
   ADMaterialProperty<Real> & _damage_rate;
+
+  // Damage used by the return map (variable or current iterate of the local damage)
+  ADReal _damage;
 };
\ No newline at end of file
@@ -26,7 +26,9 @@ public:
 protected:
   virtual void computeQpElasticGuess() override;
 
-  // Coupled variables
-  const ADVariableValue & _damage_dot;
+  // Damage variable, or damage computed locally by the viscoplastic model
+  const bool _local_damage;
+  const ADVariableValue * _damage_dot;
   const VariableValue & _damage_old;
+  const MaterialProperty<Real> * _damage_prop_old;
 };
\ No newline at end of file
@@ -27,6 +27,7 @@ protected:
   virtual void preReturnMap() override;
   virtual void postReturnMap(const ADReal & /*gamma_vp*/) override;
   virtual ADRankTwoTensor reformPlasticStrainTensor(const ADReal & gamma_vp) override;
+  virtual bool isLinearYield() const override { return true; }
 
   const Real _phi;
   const Real _psi;
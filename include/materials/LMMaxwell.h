@@ -27,6 +27,7 @@ protected:
   virtual ADReal creepRateDeriv(const ADReal & gamma_v) override;
   virtual void preReturnMap() override;
   virtual void postReturnMap(const ADReal & /*gamma_v*/) override;
+  virtual bool isLinearCreep() const override { return true; }
 
   const Real _eta;
 };
\ No newline at end of file
@@ -14,39 +14,81 @@
 #pragma once
 
 #include "ADMaterial.h"
+#include "LMIsotropicElasticity.h"
+#include "LMSymmetricTensor.h"
+#include "LMQpStepCache.h"
+#include "LMPerfGraph.h"
 
 class LMViscoElasticUpdate;
 class LMViscoPlasticUpdate;
 
-class LMMechMaterialBase : public ADMaterial
+class LMMechMaterialBase : public ADMaterial, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
   LMMechMaterialBase(const InputParameters & parameters);
   void initialSetup() override;
+  void timestepSetup() override;
   void displacementIntegrityCheck();
+  virtual void meshChanged() override;
+
+  /**
+   * Material point interface used to drive the material without a mesh (see
+   * LMMaterialPointDriver). The stress set for the first qp becomes its old stress once the
+   * stateful properties are shifted, and the elasticity tensor is evaluated for this old state.
+   */
+  void setMaterialPointStress(const RankTwoTensor & stress);
+  const ADLMIsotropicElasticity & materialPointElasticity();
 
 protected:
+  /// Qp data depending on the old state only, constant over the nonlinear iterations of a step
+  struct QpStepData
+  {
+    RankTwoTensor grad_disp_old;
+    RankTwoTensor stress_old;
+    RankTwoTensor stress_old_dev;
+  };
+
   virtual void initQpStatefulProperties() override;
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
-  virtual void computeQpStrainIncrement();
-  virtual void computeQpSmallStrain(const ADRankTwoTensor & grad_tensor,
-                                    const RankTwoTensor & grad_tensor_old);
-  virtual void computeQpFiniteStrain(const ADRankTwoTensor & grad_tensor,
-                                     const RankTwoTensor & grad_tensor_old);
+  template <unsigned int strain_model, bool has_ve, bool has_vp>
+  void computeQpPropertiesTempl();
+  template <unsigned int strain_model>
+  void computeQpStrainIncrement();
+  void computeQpSmallStrain(const ADRankTwoTensor & grad_tensor,
+                            const RankTwoTensor & grad_tensor_old);
+  void computeQpFiniteStrain(const ADRankTwoTensor & grad_tensor,
+                             const RankTwoTensor & grad_tensor_old);
   virtual void computeQpElasticityTensor() = 0;
-  virtual void computeQpStress();
+  template <bool has_ve, bool has_vp>
+  void computeQpStress();
+  template <bool has_ve, bool has_vp>
+  void computeQpConsistentTangent();
+  void storeQpElasticStrainIncrement();
+  void computeQpStepData(QpStepData & data);
   virtual void computeQpElasticGuess();
   virtual ADRankTwoTensor spinRotation(const ADRankTwoTensor & tensor);
+  ADRankTwoTensor rotatedStressOld();
 
   // Coupled variables
   const unsigned int _ndisp;
   std::vector<const ADVariableGradient *> _grad_disp;
   std::vector<const VariableGradient *> _grad_disp_old;
+  std::vector<const VariableGradient *> _grad_disp_raw;
 
   // Strain parameters
   const unsigned int _strain_model;
 
+  // Consistent tangent instead of AD derivatives of the displacements
+  const bool _consistent_tangent;
+
+  // Output-only properties stored without derivatives
+  const bool _lean_properties;
+
+  // Reuse of the old state data over the nonlinear iterations of a time step
+  const bool _cache_step_data;
+
   // Initial stress
   const std::vector<FunctionName> _initial_stress_fct;
   const unsigned int _num_ini_stress;
@@ -59,13 +101,33 @@ protected:
 
   // Strain properties
   ADMaterialProperty<RankTwoTensor> & _strain_increment;
-  ADMaterialProperty<RankTwoTensor> & _spin_increment;
-  ADMaterialProperty<RankTwoTensor> & _elastic_strain_incr;
+  ADMaterialProperty<RankTwoTensor> * _elastic_strain_incr_prop;
+  MaterialProperty<RankTwoTensor> * _elastic_strain_incr_lean;
+
+  // Output-only properties of the viscoelastic and viscoplastic models (see lean_properties)
+  ADMaterialProperty<Real> * _viscosity;
+  MaterialProperty<Real> * _viscosity_lean;
+  ADMaterialProperty<Real> * _yield_function;
+  MaterialProperty<Real> * _yield_function_lean;
+
+  // Spin and elastic strain increments of the current qp
+  ADRankTwoTensor _spin_increment;
+  ADRankTwoTensor _elastic_strain_incr;
+
+  // Stress at the start of the step and elastic trial stress increment of the current qp
+  ADRankTwoTensor _stress_start;
+  ADRankTwoTensor _stress_incr;
 
   // Stress properties
   ADMaterialProperty<Real> & _K;
+  // P-wave modulus for explicit dynamics, only declared if requested
+  MaterialProperty<Real> * _p_wave_modulus;
   ADMaterialProperty<RankTwoTensor> & _stress;
-  const MaterialProperty<RankTwoTensor> & _stress_old;
+  // Stateful stress stored with its six independent components only (the AD stress is a full
+  // tensor)
+  MaterialProperty<LMSymmetricTensor> & _stress_state;
+  const MaterialProperty<LMSymmetricTensor> & _stress_old;
+  MaterialProperty<RankFourTensor> * _tangent;
 
   // Initial stresses
   std::vector<const Function *> _initial_stress;
@@ -77,5 +139,24 @@ protected:
   LMViscoPlasticUpdate * _vp_model;
 
   // Elasticity tensor
-  ADRankFourTensor _Cijkl;
+  ADLMIsotropicElasticity _Cijkl;
+
+  // Old state data of the current element (cached or computed at each evaluation) and qp
+  LMQpStepCache<QpStepData> _step_cache;
+  std::vector<QpStepData> _elem_step_data;
+  std::vector<QpStepData> * _step_data;
+  const QpStepData * _qp_step_data;
+
+  // Qp kernel specialized on strain model x viscoelastic x viscoplastic, selected at construction
+  // (the material and model calls inside it are still dispatched at runtime)
+  void (LMMechMaterialBase::*_compute_qp_properties)();
+
+  // Timed sections (see LMPerfGraph.h)
+  const PerfID _compute_properties_timer;
+  const PerfID _strain_increment_timer;
+  const PerfID _elasticity_tensor_timer;
+  const PerfID _stress_timer;
+  const PerfID _tangent_timer;
+  const PerfID _ve_update_timer;
+  const PerfID _vp_update_timer;
 };
\ No newline at end of file
@@ -14,19 +14,26 @@
 #pragma once
 
 #include "ADMaterial.h"
+#include "LMPerfGraph.h"
 
-class LMPoroMaterial : public ADMaterial
+class LMPoroMaterial : public ADMaterial, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
   LMPoroMaterial(const InputParameters & parameters);
 
 protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
+  ADReal computeQpPorosity(const ADReal & Cd, const ADReal & damage);
 
   const VariableValue & _porosity;
   const ADVariableValue & _damage;
   const ADVariableValue & _damage_dot;
+  const bool _evolve_porosity;
+  const ADVariableValue & _pf;
+  const VariableValue & _pf_old;
   const bool _coupled_mech;
   const Real _perm;
   const Real _fluid_visco;
@@ -40,9 +47,17 @@ protected:
   const bool _has_vp;
   const ADMaterialProperty<RankTwoTensor> * _plastic_strain_incr;
   const bool _coupled_dam;
+  // Damage computed locally by the viscoplastic model instead of the damage variable
+  const bool _local_damage;
+  const ADMaterialProperty<Real> * _damage_prop;
   const ADMaterialProperty<RankTwoTensor> * _stress;
+  ADMaterialProperty<Real> * _porosity_prop;
+  const MaterialProperty<Real> * _porosity_old;
   ADMaterialProperty<Real> & _C_biot;
   MaterialProperty<Real> & _fluid_mob;
   ADMaterialProperty<Real> & _biot;
   ADMaterialProperty<Real> & _poro_mech;
+
+  // Timed section (see LMPerfGraph.h)
+  const PerfID _compute_properties_timer;
 };
\ No newline at end of file
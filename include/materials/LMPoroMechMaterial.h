@@ -26,12 +26,11 @@ protected:
   virtual void computeQpElasticityTensor() override;
 
   // Coupled variables
+  const bool _coupled_porosity;
   const VariableValue & _porosity;
+  const MaterialProperty<Real> * _porosity_old;
 
   // Elastic parameters
   const Real _compression_idx;
   const Real _poisson_ratio;
-
-  // Strain quantities
-  const MaterialProperty<RankTwoTensor> & _elastic_strain_incr_old;
 };
\ No newline at end of file
@@ -20,12 +20,13 @@ class LMSingleVarUpdate : public LMViscoPlasticUpdate
 public:
   static InputParameters validParams();
   LMSingleVarUpdate(const InputParameters & parameters);
-  virtual void viscoPlasticUpdate(ADRankTwoTensor & stress,
-                                  const ADRankFourTensor & Cijkl,
-                                  ADRankTwoTensor & elastic_strain_incr) override;
 
 protected:
-  virtual ADReal returnMap();
+  virtual bool substepUpdate(ADRankTwoTensor & stress,
+                             const ADLMIsotropicElasticity & Cijkl) override;
+  virtual bool returnMap(ADReal & gamma_vp);
+  virtual bool rawReturnMap(const ADReal & K, const ADReal & G, ADReal & gamma_vp);
+  virtual bool isLinearYield() const { return false; }
   virtual ADReal residual(const ADReal & gamma_vp);
   virtual ADReal jacobian(const ADReal & gamma_vp);
   virtual ADReal yieldFunction(const ADReal & gamma_vp) = 0;
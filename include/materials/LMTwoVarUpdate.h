@@ -20,12 +20,13 @@ class LMTwoVarUpdate : public LMViscoPlasticUpdate
 public:
   static InputParameters validParams();
   LMTwoVarUpdate(const InputParameters & parameters);
-  virtual void viscoPlasticUpdate(ADRankTwoTensor & stress,
-                                  const ADRankFourTensor & Cijkl,
-                                  ADRankTwoTensor & elastic_strain_incr) override;
 
 protected:
-  virtual void returnMap(ADReal & gamma_v, ADReal & gamma_d);
+  virtual bool substepUpdate(ADRankTwoTensor & stress,
+                             const ADLMIsotropicElasticity & Cijkl) override;
+  virtual bool returnMap(ADReal & gamma_v, ADReal & gamma_d);
+  virtual bool
+  rawReturnMap(const ADReal & K, const ADReal & G, ADReal & gamma_v, ADReal & gamma_d);
   virtual void
   residual(const ADReal & gamma_v, const ADReal & gamma_d, ADReal & resv, ADReal & resd);
   virtual void jacobian(const ADReal & gamma_v,
@@ -34,6 +35,15 @@ protected:
                         ADReal & jacdd,
                         ADReal & jacvd,
                         ADReal & jacdv);
+  void residualAndJacobian(const ADReal & gamma_v,
+                           const ADReal & gamma_d,
+                           ADReal & resv,
+                           ADReal & resd,
+                           ADReal & jacvv,
+                           ADReal & jacdd,
+                           ADReal & jacvd,
+                           ADReal & jacdv);
+  ADReal viscousCoefficient();
   virtual ADReal yieldFunction(const ADReal & chi_v, const ADReal & chi_d) = 0;
   virtual void
   overStress(const ADReal & gamma_v, const ADReal & gamma_d, ADReal & over_v, ADReal & over_d) = 0;
@@ -45,6 +55,14 @@ protected:
                                 const ADReal & gamma_d,
                                 ADReal & over_d_v,
                                 ADReal & over_d_d) = 0;
+  virtual void overStressAndDerivs(const ADReal & gamma_v,
+                                   const ADReal & gamma_d,
+                                   ADReal & over_v,
+                                   ADReal & over_d,
+                                   ADReal & over_v_v,
+                                   ADReal & over_d_v,
+                                   ADReal & over_v_d,
+                                   ADReal & over_d_d);
   virtual ADRankTwoTensor reformPlasticStrainTensor(const ADReal & gamma_v,
                                                     const ADReal & gamma_d) = 0;
   virtual void preReturnMap() = 0;
@@ -57,8 +75,11 @@ protected:
   const ADVariableValue & _pf;
   const Real _pf0;
   const Real _Ar;
+  const unsigned int _max_ls_its;
 
   ADRankTwoTensor _stress_tr;
   ADReal _K;
   ADReal _G;
+  // Viscous coefficient of the current qp, constant over the local iterations
+  ADReal _visco;
 };
\ No newline at end of file
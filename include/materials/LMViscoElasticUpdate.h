@@ -14,21 +14,40 @@
 #pragma once
 
 #include "ADMaterial.h"
+#include "LMSubsteppedReturnMap.h"
 
-class LMViscoElasticUpdate : public ADMaterial
+class LMViscoElasticUpdate : public ADMaterial, public LMSubsteppedReturnMap
 {
 public:
   static InputParameters validParams();
   LMViscoElasticUpdate(const InputParameters & parameters);
   void setQp(unsigned int qp);
+  /// Corrects the stress integrated from stress_start with the elastic trial increment stress_incr
   virtual void viscoElasticUpdate(ADRankTwoTensor & stress,
-                                  const ADRankFourTensor & Cijkl,
+                                  const ADRankTwoTensor & stress_start,
+                                  const ADRankTwoTensor & stress_incr,
+                                  const ADLMIsotropicElasticity & Cijkl,
                                   ADRankTwoTensor & elastic_strain_incr);
   void resetQpProperties() final {}
   void resetProperties() final {}
+  /// Number of local iterations of the last update (summed over substeps)
+  unsigned int numIterations() const { return _num_its; }
+  /// Whether the update depends on coupled variables (not included in the consistent tangent)
+  virtual bool hasCoupledVariables() { return false; }
+  /// Effective viscosity property declared by the mechanical material (see lean_properties)
+  void setViscosityProperty(ADMaterialProperty<Real> * viscosity,
+                            MaterialProperty<Real> * viscosity_lean);
 
 protected:
-  virtual ADReal returnMap();
+  virtual void initQpStatefulProperties() override;
+  virtual void initQpUpdate() override;
+  virtual void storeQpStatistics(LMReturnMapStatus status) override;
+  void storeQpViscosity(const ADReal & eta);
+  virtual bool substepUpdate(ADRankTwoTensor & stress,
+                             const ADLMIsotropicElasticity & Cijkl) override;
+  virtual bool returnMap(ADReal & gamma_v);
+  virtual bool rawReturnMap(ADReal & gamma_v);
+  virtual bool isLinearCreep() const { return false; }
   virtual ADReal residual(const ADReal & gamma_v);
   virtual ADReal jacobian(const ADReal & gamma_v);
   virtual ADReal stressInvariant(const ADReal & gamma_v);
@@ -43,11 +62,23 @@ protected:
   const Real _abs_tol;
   const Real _rel_tol;
   unsigned int _max_its;
+  const bool _warm_start;
+  const bool _collect_statistics;
 
   ADRankTwoTensor _stress_tr;
   ADReal _tau_tr;
   ADReal _G;
 
-  ADMaterialProperty<Real> & _viscosity;
+  // Effective viscosity, stored without derivatives if the mechanical material sets lean_properties
+  // (declared by the mechanical material)
+  ADMaterialProperty<Real> * _viscosity;
+  MaterialProperty<Real> * _viscosity_lean;
   ADMaterialProperty<RankTwoTensor> & _viscous_strain_incr;
+  // Converged scalar viscous strain rate used to warm-start the return map
+  MaterialProperty<Real> * _converged_rate;
+  const MaterialProperty<Real> * _converged_rate_old;
+  // Return map statistics (see LMReturnMapStatistic)
+  MaterialProperty<Real> * _return_map_iterations;
+  MaterialProperty<Real> * _return_map_residual_ratio;
+  MaterialProperty<Real> * _return_map_status;
 };
\ No newline at end of file
@@ -14,27 +14,58 @@
 #pragma once
 
 #include "ADMaterial.h"
+#include "LMSubsteppedReturnMap.h"
 
-class LMViscoPlasticUpdate : public ADMaterial
+class LMViscoPlasticUpdate : public ADMaterial, public LMSubsteppedReturnMap
 {
 public:
   static InputParameters validParams();
   LMViscoPlasticUpdate(const InputParameters & parameters);
   void setQp(unsigned int qp);
+  /// Corrects the stress integrated from stress_start with the elastic trial increment stress_incr
   virtual void viscoPlasticUpdate(ADRankTwoTensor & stress,
-                                  const ADRankFourTensor & Cijkl,
-                                  ADRankTwoTensor & elastic_strain_incr) = 0;
+                                  const ADRankTwoTensor & stress_start,
+                                  const ADRankTwoTensor & stress_incr,
+                                  const ADLMIsotropicElasticity & Cijkl,
+                                  ADRankTwoTensor & elastic_strain_incr);
   void resetQpProperties() final {}
   void resetProperties() final {}
+  /// Number of local iterations of the last update (summed over substeps)
+  unsigned int numIterations() const { return _num_its; }
+  /// Whether the update depends on coupled variables (not included in the consistent tangent)
+  virtual bool hasCoupledVariables() { return isCoupled("fluid_pressure"); }
+  /// Yield function property declared by the mechanical material (see lean_properties)
+  void setYieldFunctionProperty(ADMaterialProperty<Real> * yield_function,
+                                MaterialProperty<Real> * yield_function_lean);
 
 protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void initQpUpdate() override;
+  virtual void storeQpStatistics(LMReturnMapStatus status) override;
+  void storeQpYieldFunction(const ADReal & yield);
+  void declareConvergedRates(unsigned int num_rates);
+  Real initialRate(unsigned int i) const;
+  void storeConvergedRate(unsigned int i, const ADReal & gamma);
+
   const ADVariableValue & _pf;
   const Real _abs_tol;
   const Real _rel_tol;
   const unsigned int _max_its;
+  const bool _warm_start;
+  const bool _collect_statistics;
   ADReal _eta_p;
   const Real _n;
 
-  ADMaterialProperty<Real> & _yield_function;
+  // Yield function, stored without derivatives if the mechanical material sets lean_properties
+  // (declared by the mechanical material)
+  ADMaterialProperty<Real> * _yield_function;
+  MaterialProperty<Real> * _yield_function_lean;
   ADMaterialProperty<RankTwoTensor> & _plastic_strain_incr;
+  // Converged scalar strain rates used to warm-start the return map
+  std::vector<MaterialProperty<Real> *> _converged_rate;
+  std::vector<const MaterialProperty<Real> *> _converged_rate_old;
+  // Return map statistics (see LMReturnMapStatistic)
+  MaterialProperty<Real> * _return_map_iterations;
+  MaterialProperty<Real> * _return_map_residual_ratio;
+  MaterialProperty<Real> * _return_map_status;
 };
\ No newline at end of file
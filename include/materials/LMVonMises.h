@@ -25,9 +25,11 @@ protected:
   virtual void initQpStatefulProperties() override;
   virtual ADReal yieldFunction(const ADReal & gamma_vp) override;
   virtual ADReal yieldFunctionDeriv(const ADReal & gamma_vp) override;
+  virtual void initQpUpdate() override;
   virtual void preReturnMap() override;
   virtual void postReturnMap(const ADReal & gamma_vp) override;
   virtual ADRankTwoTensor reformPlasticStrainTensor(const ADReal & gamma_vp) override;
+  virtual bool isLinearYield() const override { return true; }
 
   const Real _yield_strength;
   const Real _hg;
@@ -0,0 +1,42 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+/**
+ * Maximum absolute change of a variable or of a stateful material property over the last time
+ * step, e.g. the damage or the porosity increment (see LMCostAwareDT).
+ */
+class LMMaxIncrement : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+  LMMaxIncrement(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  const bool _has_property;
+  const VariableValue & _u;
+  const VariableValue & _u_old;
+  const ADMaterialProperty<Real> * _prop;
+  const MaterialProperty<Real> * _prop_old;
+
+  Real _max_incr;
+};
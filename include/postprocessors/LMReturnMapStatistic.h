@@ -0,0 +1,64 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+/**
+ * Reduces the return map statistics stored by the viscoelastic or viscoplastic updates
+ * (collect_statistics = true) to a single value over the domain.
+ *
+ * The statistics are sampled from the last evaluation of the update materials at each qp, which
+ * is the evaluation made for this postprocessor on the current solution. The failures are the
+ * non-converged iterates accepted with failure_policy = accept. With failure_policy = cut_step, a
+ * failing return map cuts the step instead, which is counted by the time stepper, not here.
+ */
+class LMReturnMapStatistic : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+  LMReturnMapStatistic(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  const enum class StatisticType {
+    ELASTIC,
+    YIELDING,
+    SUBSTEPPED,
+    FAILURES,
+    YIELDING_FRACTION,
+    TOTAL_ITERATIONS,
+    AVERAGE_ITERATIONS,
+    MAX_ITERATIONS,
+    MAX_RESIDUAL_RATIO
+  } _statistic;
+
+  const std::string _prefix;
+  const MaterialProperty<Real> & _iterations;
+  const MaterialProperty<Real> & _residual_ratio;
+  const MaterialProperty<Real> & _status;
+
+  Real _num_elastic;
+  Real _num_yielding;
+  Real _num_substepped;
+  Real _num_failures;
+  Real _total_its;
+  Real _max_its;
+  Real _max_res_ratio;
+};
@@ -0,0 +1,40 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+/**
+ * Stable time step of the explicit central difference scheme: the minimum over the elements of
+ * h_min / c_p, where c_p = sqrt((K + 4G/3) / rho) is the P-wave speed of the current moduli.
+ */
+class LMStableTimeStep : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+  LMStableTimeStep(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  const Real _rho;
+  const Real _safety_factor;
+  const MaterialProperty<Real> & _p_wave_modulus;
+
+  Real _dt_stable;
+};
@@ -0,0 +1,51 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "TimeStepper.h"
+
+/**
+ * Time stepper growing or shrinking the time step from the cost and the activity of the last step:
+ * local return map iterations, maximum damage and porosity increments and nonlinear iterations.
+ * Each monitored quantity gives the factor target / value, the smallest one being applied to the
+ * current time step within the cutback and growth limits. The fraction of yielding qps only caps
+ * the growth of the time step.
+ */
+class LMCostAwareDT : public TimeStepper
+{
+public:
+  static InputParameters validParams();
+  LMCostAwareDT(const InputParameters & parameters);
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+  void limitFactor(Real & factor, const PostprocessorValue * value, const Real target) const;
+
+  const Real _dt_initial;
+  const Real _dt_min;
+  const Real _dt_max;
+  const Real _growth_factor;
+  const Real _cutback_factor;
+
+  const PostprocessorValue * _return_map_iterations;
+  const Real _target_return_map_iterations;
+  const PostprocessorValue * _yielding_fraction;
+  const Real _target_yielding_fraction;
+  const PostprocessorValue * _damage_increment;
+  const Real _target_damage_increment;
+  const PostprocessorValue * _porosity_increment;
+  const Real _target_porosity_increment;
+  const unsigned int _target_nl_iterations;
+};
@@ -0,0 +1,72 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "RankTwoTensor.h"
+#include "RankFourTensor.h"
+
+/**
+ * Isotropic elasticity tensor stored as its bulk and shear moduli only.
+ * The contraction with a strain tensor is C : e = K * tr(e) * I + 2 * G * dev(e).
+ */
+template <typename T>
+class LMIsotropicElasticityTempl
+{
+public:
+  LMIsotropicElasticityTempl() : _K(0.0), _G(0.0) {}
+  LMIsotropicElasticityTempl(const T & K, const T & G) : _K(K), _G(G) {}
+
+  void fill(const T & K, const T & G)
+  {
+    _K = K;
+    _G = G;
+  }
+
+  const T & bulkModulus() const { return _K; }
+  const T & shearModulus() const { return _G; }
+
+  RankTwoTensorTempl<T> operator*(const RankTwoTensorTempl<T> & strain) const
+  {
+    RankTwoTensorTempl<T> stress = 2.0 * _G * strain.deviatoric();
+    stress.addIa(_K * strain.trace());
+    return stress;
+  }
+
+  LMIsotropicElasticityTempl<T> operator*(const Real a) const
+  {
+    return LMIsotropicElasticityTempl<T>(a * _K, a * _G);
+  }
+
+  /// Full rank four representation, for the few places where it is really needed
+  RankFourTensorTempl<T> rankFourTensor() const
+  {
+    RankFourTensorTempl<T> Cijkl;
+    Cijkl.fillGeneralIsotropic(_K - 2.0 / 3.0 * _G, _G, 0.0);
+    return Cijkl;
+  }
+
+protected:
+  T _K;
+  T _G;
+};
+
+template <typename T>
+LMIsotropicElasticityTempl<T>
+operator*(const Real a, const LMIsotropicElasticityTempl<T> & elasticity)
+{
+  return elasticity * a;
+}
+
+typedef LMIsotropicElasticityTempl<Real> LMIsotropicElasticity;
+typedef LMIsotropicElasticityTempl<ADReal> ADLMIsotropicElasticity;
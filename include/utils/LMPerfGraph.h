@@ -0,0 +1,37 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "PerfGraphInterface.h"
+
+/**
+ * Timed sections of the LEMUR internals in the MOOSE perf graph, disabled by default.
+ * Build with LEMUR_PERF_GRAPH=1 (element/batch level sections) or LEMUR_PERF_GRAPH=2 (also qp
+ * level sections) to enable them, e.g. "make LEMUR_PERF_GRAPH=1".
+ */
+#ifndef LEMUR_PERF_GRAPH
+#define LEMUR_PERF_GRAPH 0
+#endif
+
+#if LEMUR_PERF_GRAPH >= 1
+#define LM_TIME_SECTION(id) TIME_SECTION(id)
+#else
+#define LM_TIME_SECTION(id)
+#endif
+
+#if LEMUR_PERF_GRAPH >= 2
+#define LM_QP_TIME_SECTION(id) TIME_SECTION(id)
+#else
+#define LM_QP_TIME_SECTION(id)
+#endif
@@ -0,0 +1,59 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <unordered_map>
+
+/**
+ * Per-element storage of qp data depending on the old state only. The data of an element is
+ * computed at its first evaluation in a time step and reused by all the following residual and
+ * Jacobian evaluations of the step. The data is keyed on the time at the end of the step, so it
+ * is emptied when the step changes or is cut (the step being solved again with a smaller time
+ * step). The owner must clear it when the step is restarted and when the mesh changes, since the
+ * element ids are reused by the new mesh.
+ */
+template <typename T>
+class LMQpStepCache
+{
+public:
+  LMQpStepCache() : _time(std::numeric_limits<Real>::lowest()) {}
+
+  /// Qp data of an element, filled is false if it still has to be computed for this step
+  std::vector<T> & elemData(dof_id_type elem_id, Real time, unsigned int n_qp, bool & filled)
+  {
+    if (time != _time)
+    {
+      _data.clear();
+      _time = time;
+    }
+
+    std::vector<T> & data = _data[elem_id];
+    filled = (data.size() == n_qp);
+    if (!filled)
+      data.resize(n_qp);
+    return data;
+  }
+
+  void clear()
+  {
+    _data.clear();
+    _time = std::numeric_limits<Real>::lowest();
+  }
+
+protected:
+  Real _time;
+  std::unordered_map<dof_id_type, std::vector<T>> _data;
+};
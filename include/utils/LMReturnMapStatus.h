@@ -0,0 +1,25 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+/// Status of the local return map at a qp, stored by the update materials when collecting
+/// statistics (collect_statistics = true)
+enum class LMReturnMapStatus
+{
+  ELASTIC,
+  CONVERGED,
+  SUBSTEPPED,
+  // Non-converged iterate accepted with failure_policy = accept
+  NOT_CONVERGED
+};
@@ -0,0 +1,70 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "InputParameters.h"
+#include "MooseEnum.h"
+#include "LMIsotropicElasticity.h"
+#include "LMReturnMapStatus.h"
+
+class MooseObject;
+
+/**
+ * Substepping and failure policy of the local return maps, shared by the viscoelastic and
+ * viscoplastic update materials. The stress is integrated from the stress at the start of the
+ * step using the elastic trial increment provided by the mechanical material, both being split
+ * in 1, 2, 4, ... max_substeps equal parts until the return map converges. Under the accept
+ * failure policy, the local solves of the finest substepping level keep their last iterate.
+ */
+class LMSubsteppedReturnMap
+{
+public:
+  static InputParameters validParams();
+  LMSubsteppedReturnMap(const MooseObject * moose_object, const std::string & model);
+  virtual ~LMSubsteppedReturnMap() = default;
+  /// Whether a non-converged iterate was accepted for the last qp updated
+  bool acceptedUnconverged() const { return _accepted_unconverged; }
+  /// Silences the warning about accepted non-converged iterates (reported by the caller instead)
+  void disableAcceptWarning() { _warned_unconverged = true; }
+
+protected:
+  void substepReturnMap(ADRankTwoTensor & stress,
+                        const ADRankTwoTensor & stress_start,
+                        const ADRankTwoTensor & stress_incr,
+                        const ADLMIsotropicElasticity & Cijkl,
+                        Real dt);
+  virtual void initQpUpdate() = 0;
+  virtual bool substepUpdate(ADRankTwoTensor & stress, const ADLMIsotropicElasticity & Cijkl) = 0;
+  virtual void storeQpStatistics(LMReturnMapStatus status) = 0;
+  /// Outcome of a local solve that did not converge: whether its last iterate is accepted
+  bool acceptUnconverged();
+
+  const std::string _return_map_name;
+  const unsigned int _max_substeps;
+  const MooseEnum _failure_policy;
+  const bool _raw_return_map;
+  bool _accept_unconverged;
+  // Whether a non-converged iterate was accepted for the current qp
+  bool _accepted_unconverged;
+  // Whether this object already warned about accepted non-converged iterates
+  bool _warned_unconverged;
+
+  // Time increment of the current local substep
+  Real _dt_sub;
+
+  // Return map statistics for the current qp
+  unsigned int _num_its;
+  Real _res_ratio;
+  bool _yielding;
+};
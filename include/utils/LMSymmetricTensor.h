@@ -0,0 +1,92 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "RankTwoTensor.h"
+#include "DataIO.h"
+
+/**
+ * Symmetric second order tensor stored as its six independent components in Voigt order
+ * (xx, yy, zz, yz, xz, xy). Only used for the stateful storage of the stress, which only needs
+ * to be expanded to a full RankTwoTensor when it enters the update of the next time step. The AD
+ * stress, the strain increments and the tensors of the return maps remain full RankTwoTensors.
+ */
+template <typename T>
+class LMSymmetricTensorTempl
+{
+public:
+  LMSymmetricTensorTempl() { zero(); }
+
+  /// Symmetric part of a full tensor
+  explicit LMSymmetricTensorTempl(const RankTwoTensorTempl<T> & a)
+  {
+    for (unsigned int i = 0; i < 3; ++i)
+      _vals[i] = a(i, i);
+    _vals[3] = 0.5 * (a(1, 2) + a(2, 1));
+    _vals[4] = 0.5 * (a(0, 2) + a(2, 0));
+    _vals[5] = 0.5 * (a(0, 1) + a(1, 0));
+  }
+
+  /// Voigt index of the (i, j) component
+  static unsigned int index(unsigned int i, unsigned int j) { return i == j ? i : 6 - i - j; }
+
+  const T & operator()(unsigned int i, unsigned int j) const { return _vals[index(i, j)]; }
+  T & operator()(unsigned int i, unsigned int j) { return _vals[index(i, j)]; }
+  const T & operator[](unsigned int c) const { return _vals[c]; }
+  T & operator[](unsigned int c) { return _vals[c]; }
+
+  void zero()
+  {
+    for (unsigned int c = 0; c < 6; ++c)
+      _vals[c] = 0.0;
+  }
+
+  void addIa(const T & a)
+  {
+    for (unsigned int i = 0; i < 3; ++i)
+      _vals[i] += a;
+  }
+
+  T trace() const { return _vals[0] + _vals[1] + _vals[2]; }
+
+  LMSymmetricTensorTempl<T> deviatoric() const
+  {
+    LMSymmetricTensorTempl<T> dev = *this;
+    dev.addIa(-trace() / 3.0);
+    return dev;
+  }
+
+  /// Frobenius norm, the shear components counting twice
+  T L2norm() const
+  {
+    T norm2 = _vals[0] * _vals[0] + _vals[1] * _vals[1] + _vals[2] * _vals[2];
+    norm2 += 2.0 * (_vals[3] * _vals[3] + _vals[4] * _vals[4] + _vals[5] * _vals[5]);
+    return std::sqrt(norm2);
+  }
+
+  RankTwoTensorTempl<T> toRankTwoTensor() const
+  {
+    return RankTwoTensorTempl<T>(_vals[0], _vals[1], _vals[2], _vals[3], _vals[4], _vals[5]);
+  }
+
+protected:
+  T _vals[6];
+};
+
+typedef LMSymmetricTensorTempl<Real> LMSymmetricTensor;
+
+template <>
+void dataStore(std::ostream & stream, LMSymmetricTensor & v, void * context);
+template <>
+void dataLoad(std::istream & stream, LMSymmetricTensor & v, void * context);
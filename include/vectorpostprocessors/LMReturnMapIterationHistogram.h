@@ -0,0 +1,41 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       LEMUR, a MOOSE-based application                     */
+/*          muLtiphysics of gEomaterials using MUltiscale Rheologies          */
+/*                                                                            */
+/*                  Copyright (C) 2020 by Antoine B. Jacquey                  */
+/*                    Massachusetts Institute of Technology                   */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementVectorPostprocessor.h"
+
+/**
+ * Histogram of the number of local iterations of the return map over the yielding qps.
+ * Requires collect_statistics = true in the monitored update material.
+ */
+class LMReturnMapIterationHistogram : public ElementVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+  LMReturnMapIterationHistogram(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  const unsigned int _num_bins;
+  const std::string _prefix;
+  const MaterialProperty<Real> & _iterations;
+  const MaterialProperty<Real> & _status;
+
+  VectorPostprocessorValue & _bin_its;
+  VectorPostprocessorValue & _bin_count;
+};
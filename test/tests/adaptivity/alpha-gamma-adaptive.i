@@ -0,0 +1,161 @@
+# Refinement and coarsening driven by the proximity to the alpha-gamma yield surface under a
+# homogeneous isochoric loading and unloading. The stress being computed incrementally, it is only
+# correct if the stateful properties are projected on the refined and coarsened elements.
+# The yield_proximity indicator is 8 * e * sqrt(V) for a strain e and an element volume V:
+# the mesh is refined after the second step and coarsened back after the fifth one.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./mech_x]
+    type = LMStressDivergence
+    variable = disp_x
+    component = 0
+  [../]
+  [./mech_y]
+    type = LMStressDivergence
+    variable = disp_y
+    component = 1
+  [../]
+  [./mech_z]
+    type = LMStressDivergence
+    variable = disp_z
+    component = 2
+  [../]
+[]
+
+[AuxVariables]
+  [./pressure]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./eqv_stress]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./stress_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[AuxKernels]
+  [./pressure_aux]
+    type = LMPressureAux
+    variable = pressure
+  [../]
+  [./eqv_stress_aux]
+    type = LMVonMisesStressAux
+    variable = eqv_stress
+  [../]
+  [./stress_xx_aux]
+    type = LMStressAux
+    variable = stress_xx
+    index_i = 0
+    index_j = 0
+  [../]
+[]
+
+[BCs]
+  [./ux]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'left right bottom top front back'
+    function = '0.01*if(t<3,t,6-t)*x'
+  [../]
+  [./uy]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = 'left right bottom top front back'
+    function = '-0.01*if(t<3,t,6-t)*y'
+  [../]
+  [./no_uz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'left right bottom top front back'
+    value = 0.0
+  [../]
+[]
+
+[Materials]
+  [./elastic_mat]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 1.0
+    shear_modulus = 1.0
+    initial_stress = '-0.5 -0.5 -0.5'
+    viscoplastic_model = 'plastic'
+  [../]
+  [./plastic]
+    type = LMAlphaGammaYield
+    friction_angle = 30.0
+    critical_pressure = 1.0
+    plastic_viscosity = 1.0
+  [../]
+[]
+
+[Adaptivity]
+  marker = localization
+  max_h_level = 1
+  [./Indicators]
+    [./yield_proximity]
+      type = LMInelasticIndicator
+      quantity = yield_function
+      yield_tolerance = 1.0
+    [../]
+  [../]
+  [./Markers]
+    [./localization]
+      type = LMLocalizationMarker
+      indicators = 'yield_proximity'
+      refine = '0.04'
+      coarsen = '0.015'
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./num_elems]
+    type = NumElems
+  [../]
+  [./pressure]
+    type = ElementAverageValue
+    variable = pressure
+  [../]
+  [./eqv_stress]
+    type = ElementAverageValue
+    variable = eqv_stress
+  [../]
+  [./stress_xx]
+    type = ElementAverageValue
+    variable = stress_xx
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0.0
+  num_steps = 6
+  dt = 1.0
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  print_linear_residuals = false
+  csv = true
+[]
@@ -0,0 +1,116 @@
+# Uniaxial strain of a unit cube under a follower pressure with finite strains.
+# The lateral displacements being fixed, the loaded face keeps its reference area and normal,
+# so that the axial Cauchy stress equals the applied pressure and the stretch follows
+# lambda_n = lambda_n-1 / (1 + dp / (K + 4G/3)) for each pressure increment dp.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 1
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./mech_x]
+    type = LMStressDivergence
+    variable = disp_x
+    component = 0
+  [../]
+  [./mech_y]
+    type = LMStressDivergence
+    variable = disp_y
+    component = 1
+  [../]
+  [./mech_z]
+    type = LMStressDivergence
+    variable = disp_z
+    component = 2
+  [../]
+[]
+
+[BCs]
+  [./no_ux]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0.0
+    preset = true
+  [../]
+  [./no_uy]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom top'
+    value = 0.0
+    preset = true
+  [../]
+  [./no_uz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'back front'
+    value = 0.0
+    preset = true
+  [../]
+  [./pressure_right]
+    type = LMFollowerPressureBC
+    variable = disp_x
+    component = 0
+    displacements = 'disp_x disp_y disp_z'
+    boundary = right
+    function = 't'
+  [../]
+[]
+
+[Materials]
+  [./elastic_mat]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    strain_model = finite
+    bulk_modulus = 10.0
+    shear_modulus = 6.0
+  [../]
+[]
+
+[Postprocessors]
+  [./pressure]
+    type = FunctionValuePostprocessor
+    function = 't'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./ux]
+    type = PointValue
+    variable = disp_x
+    point = '1 1 1'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./precond]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  nl_abs_tol = 1.0e-12
+  nl_rel_tol = 1.0e-12
+  start_time = 0.0
+  end_time = 1.0
+  dt = 0.1
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,221 @@
+# Comparison of the damage integrated locally (solved with the return map) and of the damage
+# variable (monolithic coupling) for a homogeneous uniaxial compression. Block 0 uses the damage variable,
+# block 1 the local damage. All nodes are on the boundary, so the strain path is prescribed.
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 2
+    ny = 1
+    nz = 1
+    xmin = 0
+    xmax = 2
+    ymin = 0
+    ymax = 1
+    zmin = 0
+    zmax = 1
+  [../]
+  [./local_block]
+    type = SubdomainBoundingBoxGenerator
+    input = gen
+    block_id = 1
+    bottom_left = '1 0 0'
+    top_right = '2 1 1'
+  [../]
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+  [./damage]
+    block = 0
+  [../]
+[]
+
+[Kernels]
+  [./mech_x]
+    type = LMStressDivergence
+    variable = disp_x
+    component = 0
+  [../]
+  [./mech_y]
+    type = LMStressDivergence
+    variable = disp_y
+    component = 1
+  [../]
+  [./mech_z]
+    type = LMStressDivergence
+    variable = disp_z
+    component = 2
+  [../]
+  [./damage_dot]
+    type = ADTimeDerivative
+    variable = damage
+    block = 0
+  [../]
+  [./damage_rate]
+    type = LMDamageRate
+    variable = damage
+    block = 0
+  [../]
+[]
+
+[AuxVariables]
+  [./pressure]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./eqv_stress]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./damage_local]
+    order = CONSTANT
+    family = MONOMIAL
+    block = 1
+  [../]
+[]
+
+[AuxKernels]
+  [./pressure_aux]
+    type = LMPressureAux
+    variable = pressure
+  [../]
+  [./eqv_stress_aux]
+    type = LMVonMisesStressAux
+    variable = eqv_stress
+  [../]
+  [./damage_local_aux]
+    type = ADMaterialRealAux
+    variable = damage_local
+    property = damage
+    block = 1
+  [../]
+[]
+
+[BCs]
+  [./ux]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'left right bottom top front back'
+    function = '-0.02*t*x'
+  [../]
+  [./no_uy]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'left right bottom top front back'
+    value = 0.0
+  [../]
+  [./no_uz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'left right bottom top front back'
+    value = 0.0
+  [../]
+[]
+
+[Materials]
+  [./coupled_mat]
+    type = LMDamageMechMaterial
+    block = 0
+    displacements = 'disp_x disp_y disp_z'
+    damage = damage
+    bulk_modulus = 10.0
+    shear_modulus = 10.0
+    viscoplastic_model = 'coupled_damage'
+  [../]
+  [./coupled_damage]
+    type = LMDamageAlphaGammaYield
+    block = 0
+    damage = damage
+    friction_angle = 30.0
+    critical_pressure = 1.0
+    plastic_viscosity = 1.0
+    rv = 0.9
+    rs = 0.9
+  [../]
+  [./local_mat]
+    type = LMDamageMechMaterial
+    block = 1
+    displacements = 'disp_x disp_y disp_z'
+    local_damage = true
+    bulk_modulus = 10.0
+    shear_modulus = 10.0
+    viscoplastic_model = 'local_damage'
+  [../]
+  [./local_damage]
+    type = LMDamageAlphaGammaYield
+    block = 1
+    local_damage = true
+    friction_angle = 30.0
+    critical_pressure = 1.0
+    plastic_viscosity = 1.0
+    rv = 0.9
+    rs = 0.9
+  [../]
+[]
+
+[Postprocessors]
+  [./damage_coupled]
+    type = ElementAverageValue
+    variable = damage
+    block = 0
+  [../]
+  [./damage_local]
+    type = ElementAverageValue
+    variable = damage_local
+    block = 1
+  [../]
+  [./damage_difference]
+    type = DifferencePostprocessor
+    value1 = damage_coupled
+    value2 = damage_local
+  [../]
+  [./p_coupled]
+    type = ElementAverageValue
+    variable = pressure
+    block = 0
+  [../]
+  [./p_local]
+    type = ElementAverageValue
+    variable = pressure
+    block = 1
+  [../]
+  [./q_coupled]
+    type = ElementAverageValue
+    variable = eqv_stress
+    block = 0
+  [../]
+  [./q_local]
+    type = ElementAverageValue
+    variable = eqv_stress
+    block = 1
+  [../]
+[]
+
+[Preconditioning]
+  [./precond]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  nl_abs_tol = 1.0e-14
+  nl_rel_tol = 1.0e-12
+  start_time = 0.0
+  end_time = 2.0
+  dt = 0.1
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  print_linear_residuals = false
+  csv = true
+[]
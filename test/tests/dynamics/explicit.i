@@ -0,0 +1,116 @@
+# Explicit dynamics of a unit cube pulled by opposite tractions on its left and right faces
+# (central difference with a lumped mass matrix). With a single element and a lumped mass, the
+# strain stays homogeneous and the displacements follow the central difference scheme of two
+# coupled oscillators (axial and lateral strains).
+# The stable time step is evaluated at the end of each step, which also updates the incremental
+# stress with the new displacements for the residual of the next step.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 1
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./inertia_x]
+    type = LMInertialForce
+    variable = disp_x
+    density = 1.0
+  [../]
+  [./inertia_y]
+    type = LMInertialForce
+    variable = disp_y
+    density = 1.0
+  [../]
+  [./inertia_z]
+    type = LMInertialForce
+    variable = disp_z
+    density = 1.0
+  [../]
+  [./grad_stress_x]
+    type = LMStressDivergence
+    variable = disp_x
+    component = 0
+  [../]
+  [./grad_stress_y]
+    type = LMStressDivergence
+    variable = disp_y
+    component = 1
+  [../]
+  [./grad_stress_z]
+    type = LMStressDivergence
+    variable = disp_z
+    component = 2
+  [../]
+[]
+
+[BCs]
+  [./traction_left]
+    type = NeumannBC
+    variable = disp_x
+    boundary = left
+    value = -1.0
+  [../]
+  [./traction_right]
+    type = NeumannBC
+    variable = disp_x
+    boundary = right
+    value = 1.0
+  [../]
+[]
+
+[Materials]
+  [./mechanical]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 5.0
+    shear_modulus = 3.0
+    compute_p_wave_modulus = true
+  [../]
+[]
+
+[Postprocessors]
+  [./dt_stable]
+    type = LMStableTimeStep
+    density = 1.0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./ux]
+    type = PointValue
+    variable = disp_x
+    point = '1 1 1'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./uy]
+    type = PointValue
+    variable = disp_y
+    point = '1 1 1'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 0
+  end_time = 1
+  dt = 0.05
+  [./TimeIntegrator]
+    type = CentralDifference
+    solve_type = lumped
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,179 @@
+# Terzaghi's problem of consolodation of a drained medium
+#
+# See Arnold Verruijt "Theory and Problems of Poroelasticity" 2015
+# Section 2.2 Terzaghi's problem
+#
+# Same as terzaghi.i solved with the fixed-stress split: this input solves the fluid flow and
+# the mechanics runs in a sub-app (terzaghi-fixed-stress-mech.i). Both are iterated within each
+# time step until convergence to the monolithic solution. The stabilization uses the constrained
+# modulus of the confined 1D problem: K / (K + 4/3 G) = 0.5
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 10
+  xmin = -0.1
+  xmax = 0.1
+  ymin = -0.1
+  ymax = 1
+  zmin = 0
+  zmax = 1
+[]
+
+[Variables]
+  [./pf]
+  [../]
+[]
+
+[AuxVariables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+  [./pf_iterate]
+  [../]
+  [./phi]
+    initial_condition = 0.1
+  [../]
+[]
+
+[AuxKernels]
+  [./phi_aux]
+    type = ConstantAux
+    variable = phi
+    value = 0.1
+  [../]
+[]
+
+[Kernels]
+  [./pf_time_derivative]
+    type = LMFluidFlowTimeDerivative
+    variable = pf
+  [../]
+  [./darcy]
+    type = LMFluidFlowDarcy
+    variable = pf
+  [../]
+  [./fixed_stress]
+    type = LMFixedStressStabilization
+    variable = pf
+    fluid_pressure_iterate = pf_iterate
+    stabilization_factor = 0.5
+  [../]
+[]
+
+[BCs]
+  [./topdrained]
+    type = DirichletBC
+    variable = pf
+    value = 0
+    boundary = front
+  [../]
+[]
+
+[Materials]
+  [./mechanical]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 4
+    shear_modulus = 3
+  [../]
+  [./hydraulic]
+    type = LMPoroMaterial
+    porosity = phi
+    permeability = 1.5e-02
+    fluid_viscosity = 1.395348837e-01
+    fluid_modulus = 8
+    solid_modulus = 10
+  [../]
+[]
+
+[MultiApps]
+  [./mechanics]
+    type = TransientMultiApp
+    app_type = LemurApp
+    input_files = terzaghi-fixed-stress-mech.i
+    execute_on = timestep_end
+  [../]
+[]
+
+[Transfers]
+  [./pf_to_mechanics]
+    type = MultiAppCopyTransfer
+    direction = to_multiapp
+    multi_app = mechanics
+    source_variable = pf
+    variable = pf
+  [../]
+  [./pf_iterate_from_mechanics]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = pf
+    variable = pf_iterate
+  [../]
+  [./disp_x_from_mechanics]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = disp_x
+    variable = disp_x
+  [../]
+  [./disp_y_from_mechanics]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = disp_y
+    variable = disp_y
+  [../]
+  [./disp_z_from_mechanics]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = disp_z
+    variable = disp_z
+  [../]
+[]
+
+[Preconditioning]
+  [./lu]
+    type = SMP
+    petsc_options_iname = '-pc_type -snes_atol'
+    petsc_options_value = 'lu 1.0e-14'
+  [../]
+[]
+
+[Functions]
+  [./time_stepper_fct]
+    type = PiecewiseConstant
+    x = '0      0.01  0.1'
+    y = '0.001 0.01 0.1'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0
+  end_time = 10 # ~10 s
+  picard_max_its = 50
+  picard_rel_tol = 1.0e-10
+  picard_abs_tol = 1.0e-14
+  [./TimeStepper]
+    type = FunctionDT
+    function = time_stepper_fct
+  [../]
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  execute_on = 'TIMESTEP_END'
+  [./exodus]
+    type = Exodus
+    hide = 'pf_iterate'
+  [../]
+[]
@@ -0,0 +1,176 @@
+# Terzaghi's problem of consolodation of a drained medium with the porosity evolved as a stateful
+# material property from a constant initial value (no porosity variable). The porosity dependent
+# elasticity reads the porosity of the previous time step. The top load includes the initial
+# stress.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 10
+  xmin = -0.1
+  xmax = 0.1
+  ymin = -0.1
+  ymax = 1
+  zmin = 0
+  zmax = 1
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+  [./pf]
+  [../]
+[]
+
+[Kernels]
+  [./grad_stress_x]
+    type = LMStressDivergence
+    variable = disp_x
+    fluid_pressure = pf
+    component = 0
+  [../]
+  [./grad_stress_y]
+    type = LMStressDivergence
+    variable = disp_y
+    fluid_pressure = pf
+    component = 1
+  [../]
+  [./grad_stress_z]
+    type = LMStressDivergence
+    variable = disp_z
+    fluid_pressure = pf
+    component = 2
+  [../]
+  [./pf_time_derivative]
+    type = LMFluidFlowTimeDerivative
+    variable = pf
+  [../]
+  [./darcy]
+    type = LMFluidFlowDarcy
+    variable = pf
+  [../]
+[]
+
+[AuxVariables]
+  [./phi]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[AuxKernels]
+  [./phi_aux]
+    type = ADMaterialRealAux
+    variable = phi
+    property = porosity
+  [../]
+[]
+
+[BCs]
+  [./confinex]
+    type = DirichletBC
+    variable = disp_x
+    value = 0
+    boundary = 'left right'
+    preset = true
+  [../]
+  [./confiney]
+    type = DirichletBC
+    variable = disp_y
+    value = 0
+    boundary = 'bottom top'
+    preset = true
+  [../]
+  [./basefixed]
+    type = DirichletBC
+    variable = disp_z
+    value = 0
+    boundary = back
+    preset = true
+  [../]
+  [./topdrained]
+    type = DirichletBC
+    variable = pf
+    value = 0
+    boundary = front
+  [../]
+  [./topload]
+    type = NeumannBC
+    variable = disp_z
+    value = -2
+    boundary = front
+  [../]
+[]
+
+[Materials]
+  [./mechanical]
+    type = LMPoroMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    compression_index = 0.25
+    poisson_ratio = 0.2
+    initial_stress = '-1 -1 -1'
+  [../]
+  [./hydraulic]
+    type = LMPoroMaterial
+    porosity = 0.1
+    evolve_porosity = true
+    fluid_pressure = pf
+    permeability = 1.5e-02
+    fluid_viscosity = 1.395348837e-01
+    fluid_modulus = 8
+    solid_modulus = 10
+  [../]
+[]
+
+[Postprocessors]
+  [./uz_top]
+    type = PointValue
+    variable = disp_z
+    point = '0.0 0.0 1.0'
+  [../]
+  [./pf_bottom]
+    type = PointValue
+    variable = pf
+    point = '0.0 0.0 0.0'
+  [../]
+  [./pf_middle]
+    type = PointValue
+    variable = pf
+    point = '0.0 0.0 0.5'
+  [../]
+  [./phi_average]
+    type = ElementAverageValue
+    variable = phi
+  [../]
+[]
+
+[Preconditioning]
+  [./lu]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -pc_factor_shift_type'
+    petsc_options_value = 'lu NONZERO'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  nl_abs_tol = 1.0e-14
+  nl_rel_tol = 1.0e-12
+  start_time = 0
+  end_time = 2
+  dt = 0.05
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  execute_on = 'TIMESTEP_END'
+  csv = true
+[]
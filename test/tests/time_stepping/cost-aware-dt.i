@@ -0,0 +1,128 @@
+# Time step adapted to the porosity increment of a single element under a prescribed uniaxial
+# compression. The time step doubles until the porosity increment reaches its target.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 1
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./mech_x]
+    type = LMStressDivergence
+    variable = disp_x
+    component = 0
+  [../]
+  [./mech_y]
+    type = LMStressDivergence
+    variable = disp_y
+    component = 1
+  [../]
+  [./mech_z]
+    type = LMStressDivergence
+    variable = disp_z
+    component = 2
+  [../]
+[]
+
+[AuxVariables]
+  [./phi]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[AuxKernels]
+  [./phi_aux]
+    type = ADMaterialRealAux
+    variable = phi
+    property = porosity
+  [../]
+[]
+
+[BCs]
+  [./ux]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'left right bottom top front back'
+    function = '-0.01*t*x'
+  [../]
+  [./no_uy]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'left right bottom top front back'
+    value = 0.0
+  [../]
+  [./no_uz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'left right bottom top front back'
+    value = 0.0
+  [../]
+[]
+
+[Materials]
+  [./mechanical]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 4
+    shear_modulus = 3
+  [../]
+  [./hydraulic]
+    type = LMPoroMaterial
+    porosity = 0.1
+    evolve_porosity = true
+    permeability = 1.0
+    fluid_viscosity = 1.0
+    fluid_modulus = 8
+    solid_modulus = 10
+  [../]
+[]
+
+[Postprocessors]
+  [./porosity_increment]
+    type = LMMaxIncrement
+    property = porosity
+  [../]
+  [./disp_increment]
+    type = LMMaxIncrement
+    variable = disp_x
+  [../]
+  [./porosity]
+    type = ElementAverageValue
+    variable = phi
+  [../]
+  [./dt]
+    type = TimestepSize
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0.0
+  num_steps = 10
+  [./TimeStepper]
+    type = LMCostAwareDT
+    dt = 0.01
+    growth_factor = 2.0
+    porosity_increment = porosity_increment
+    target_porosity_increment = 1.0e-03
+  [../]
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  print_linear_residuals = false
+  csv = true
+[]
@@ -0,0 +1,144 @@
+# Alpha-gamma viscoplasticity with critical pressure hardening. A unit cube with an initial
+# isotropic stress is compressed in homogeneous uniaxial strain (all nodes are prescribed). Once
+# the stress reaches the cap, the volumetric plastic strain hardens the critical pressure and the
+# equivalent stress keeps increasing with the pressure.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 1
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./mech_x]
+    type = LMStressDivergence
+    variable = disp_x
+    component = 0
+  [../]
+  [./mech_y]
+    type = LMStressDivergence
+    variable = disp_y
+    component = 1
+  [../]
+  [./mech_z]
+    type = LMStressDivergence
+    variable = disp_z
+    component = 2
+  [../]
+[]
+
+[AuxVariables]
+  [./pressure]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./eqv_stress]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./vol_plastic_strain]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[AuxKernels]
+  [./pressure_aux]
+    type = LMPressureAux
+    variable = pressure
+  [../]
+  [./eqv_stress_aux]
+    type = LMVonMisesStressAux
+    variable = eqv_stress
+  [../]
+  [./vol_plastic_strain_aux]
+    type = ADMaterialRealAux
+    variable = vol_plastic_strain
+    property = volumetric_plastic_strain
+  [../]
+[]
+
+[BCs]
+  [./ux]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'left right bottom top front back'
+    function = '-0.02*t*x'
+  [../]
+  [./no_uy]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'left right bottom top front back'
+    value = 0.0
+  [../]
+  [./no_uz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'left right bottom top front back'
+    value = 0.0
+  [../]
+[]
+
+[Materials]
+  [./elastic_mat]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 10.0
+    shear_modulus = 10.0
+    initial_stress = '-0.3 -0.3 -0.3'
+    viscoplastic_model = 'plastic'
+  [../]
+  [./plastic]
+    type = LMAlphaGammaYield
+    friction_angle = 30.0
+    critical_pressure = 1.0
+    critical_pressure_hardening = 20.0
+    plastic_viscosity = 1.0
+  [../]
+[]
+
+[Postprocessors]
+  [./eqv_stress]
+    type = ElementAverageValue
+    variable = eqv_stress
+  [../]
+  [./pressure]
+    type = ElementAverageValue
+    variable = pressure
+  [../]
+  [./volumetric_plastic_strain]
+    type = ElementAverageValue
+    variable = vol_plastic_strain
+  [../]
+[]
+
+[Preconditioning]
+  [./precond]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0.0
+  end_time = 2.0
+  dt = 0.1
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  csv = true
+[]
@@ -0,0 +1,132 @@
+# Substepping of the viscoplastic return map. A unit cube is loaded in homogeneous isochoric
+# strain (all nodes are prescribed) with a Von Mises viscoplastic update whose local Newton loop
+# is limited to 4 iterations. From the fourth step, the full step does not converge within these
+# iterations and the step is split in two substeps.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 1
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+[]
+
+[Kernels]
+  [./mech_x]
+    type = LMStressDivergence
+    variable = disp_x
+    component = 0
+  [../]
+  [./mech_y]
+    type = LMStressDivergence
+    variable = disp_y
+    component = 1
+  [../]
+  [./mech_z]
+    type = LMStressDivergence
+    variable = disp_z
+    component = 2
+  [../]
+[]
+
+[AuxVariables]
+  [./Se]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[AuxKernels]
+  [./Se_aux]
+    type = LMVonMisesStressAux
+    variable = Se
+  [../]
+[]
+
+[BCs]
+  [./ux]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'left right bottom top back front'
+    function = 't*x'
+  [../]
+  [./uy]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = 'left right bottom top back front'
+    function = '-t*y'
+  [../]
+  [./no_uz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'left right bottom top back front'
+    value = 0.0
+  [../]
+[]
+
+[Materials]
+  [./elastic_mat]
+    type = LMMechMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 10.0
+    shear_modulus = 10.0
+    viscoplastic_model = 'vp_model'
+  [../]
+  [./vp_model]
+    type = LMVonMises
+    yield_strength = 0.3
+    plastic_viscosity = 3.0
+    exponent = 2.0
+    max_iterations = 4
+    max_substeps = 8
+    collect_statistics = true
+  [../]
+[]
+
+[Postprocessors]
+  [./eqv_stress]
+    type = ElementAverageValue
+    variable = Se
+    execute_on = 'initial timestep_end'
+  [../]
+  [./max_iterations]
+    type = LMReturnMapStatistic
+    return_map = viscoplastic
+    statistic = max_iterations
+    execute_on = 'initial timestep_end'
+  [../]
+  [./substepped]
+    type = LMReturnMapStatistic
+    return_map = viscoplastic
+    statistic = substepped
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./precond]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0.0
+  end_time = 1.0
+  dt = 0.1
+[]
+
+[Outputs]
+  csv = true
+[]